@@ -222,6 +222,9 @@ void EffectSs_Insert(PlayState* play, EffectSs* effectSs);
 void EffectSs_Spawn(PlayState* play, s32 type, s32 priority, void* initParams);
 void EffectSs_UpdateAll(PlayState* play);
 void EffectSs_DrawAll(PlayState* play);
+void EffectSs_RebuildOccupied(void);
+s32 EffectSs_GetNumActive(void);
+s32 EffectSs_GetHighWaterMark(void);
 s16 func_80027DD4(s16 arg0, s16 arg1, s32 arg2);
 s16 func_80027E34(s16 arg0, s16 arg1, f32 arg2);
 u8 func_80027E84(u8 arg0, u8 arg1, f32 arg2);
@@ -1690,6 +1693,7 @@ void PadMgr_RumbleSet(PadMgr* padmgr, u8* ctrlrRumbles);
 void PadMgr_ProcessInputs(PadMgr* padmgr);
 void PadMgr_HandleRetraceMsg(PadMgr* padmgr);
 void PadMgr_HandlePreNMI(PadMgr* padmgr);
+void PadMgr_LogInputLatency(void);
 // This function must remain commented out, because it is called incorrectly in
 // fault.c (actual bug in game), and the compiler notices and won't compile it
 void PadMgr_RequestPadData(PadMgr* padmgr, Input* inputs, s32 mode);
@@ -1989,6 +1993,9 @@ void AudioLoad_LoadPermanentSamples(void);
 void AudioLoad_ScriptLoad(s32 tableType, s32 arg1, s8* arg2);
 void AudioLoad_ProcessScriptLoads(void);
 void AudioLoad_InitScriptLoads(void);
+SoundFont* AudioLoad_GetSoundFont(s32 fontId);
+SequenceData AudioLoad_GetSequenceData(s32 seqId);
+void AudioLoad_GetHostCacheStats(AudioHostCacheStats* stats);
 AudioTask* func_800E4FE0(void);
 void Audio_QueueCmdF32(u32 arg0, f32 arg1);
 void Audio_QueueCmdS32(u32 arg0, s32 arg1);
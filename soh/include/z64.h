@@ -370,6 +370,10 @@ typedef struct {
     /* 0x0128 */ TitleCardContext titleCtx;
     /* 0x0138 */ char   unk_138[0x04];
     /* 0x013C */ void*  absoluteSpace; // Space used to allocate actor overlays of alloc type 1
+    // #region SOH [General]
+    // Head of the list of loaded actors for each actor id, most recently categorized first like `actorLists`
+    /*        */ Actor* actorIdIndex[ACTOR_ID_MAX];
+    // #endregion
 } ActorContext; // size = 0x140
 
 typedef struct {
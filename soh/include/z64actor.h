@@ -180,6 +180,8 @@ typedef struct Actor {
     /* 0x13C */ char dbgPad[0x10]; // Padding that only exists in the debug rom
     // #region SOH [General]
     /*       */ u8 maximumHealth; // Max health value for use with health bars, set on actor init
+    /*       */ struct Actor* prevById; // Previous actor with the same id, see `ActorContext.actorIdIndex`
+    /*       */ struct Actor* nextById; // Next actor with the same id, see `ActorContext.actorIdIndex`
     // #endregion
 } Actor; // size = 0x14C
 
@@ -387,4 +389,15 @@ typedef struct {
     /* 0x24 */ char unk_24[0x4];
 } NpcInteractInfo; // size = 0x28
 
+// #region SOH [General]
+// Per frame counters for the main actor draw pass, shown in the actor viewer
+typedef struct {
+    u32 considered; // Actors with a draw function that finished initializing
+    u32 culled; // Considered actors outside the view that don't draw while culled
+    u32 drawn;
+    u32 lightsElided; // Draws that reused the previous actor's identical light set
+    u32 bytesSaved; // Display list bytes not emitted thanks to elided light sets
+} ActorDrawStats;
+// #endregion
+
 #endif
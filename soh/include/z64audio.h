@@ -1119,6 +1119,12 @@ typedef struct {
     uint8_t fonts[16];
 } SequenceData;
 
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t numEntries;
+} AudioHostCacheStats;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
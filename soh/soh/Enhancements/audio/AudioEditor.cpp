@@ -440,6 +440,17 @@ void AudioEditor::DrawElement() {
                                             "engine to play. Enabling this checkbox will cause these notes to drop a "
                                             "couple of octaves so they can still harmonize with the other notes of the "
                                             "sequence.");
+
+                UIWidgets::PaddedSeparator();
+                UIWidgets::EnhancementCheckbox("Cache Sequence/Soundfont Lookups", "gAudioHostCache", false, "",
+                                               UIWidgets::CheckboxGraphics::Cross, true);
+                UIWidgets::InsertHelpHoverText("Keeps resolved sequences and soundfonts by id instead of looking them "
+                                               "up by name on every note. Turn off to compare against the uncached "
+                                               "lookup.");
+                AudioHostCacheStats cacheStats;
+                AudioLoad_GetHostCacheStats(&cacheStats);
+                ImGui::Text("Resolved sequences/soundfonts: %u", cacheStats.numEntries);
+                ImGui::Text("Lookup hits: %u  Misses: %u", cacheStats.hits, cacheStats.misses);
                 ImGui::PopItemWidth();
             }
             ImGui::EndChild();
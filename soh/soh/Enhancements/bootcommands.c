@@ -2,6 +2,8 @@
 #include "gameconsole.h"
 #include <macros.h>
 #include <z64.h>
+#include <stdlib.h>
+#include "headless/HeadlessMode.h"
 #include <libultraship/libultra.h>
 #include <libultraship/bridge.h>
 #include <functions.h>
@@ -14,9 +16,19 @@ uint8_t gLoadFileSelect = 0, gSkipLogoTest = 0;
 
 extern BootCommandFunc BootCommands_Command_SkipLogo(char** argv, s32 argc);
 extern BootCommandFunc BootCommands_Command_LoadFileSelect(char** argv, s32 argc);
+extern BootCommandFunc BootCommands_Command_Headless(char** argv, s32 argc);
+extern BootCommandFunc BootCommands_Command_NoAudio(char** argv, s32 argc);
+extern BootCommandFunc BootCommands_Command_Frames(char** argv, s32 argc);
+extern BootCommandFunc BootCommands_Command_Record(char** argv, s32 argc);
+extern BootCommandFunc BootCommands_Command_Replay(char** argv, s32 argc);
 
 static BootCommand sCommands[] = { { "--skiplogo", BootCommands_Command_SkipLogo },
-                                   { "--loadfileselect", BootCommands_Command_LoadFileSelect } };
+                                   { "--loadfileselect", BootCommands_Command_LoadFileSelect },
+                                   { "--headless", BootCommands_Command_Headless },
+                                   { "--noaudio", BootCommands_Command_NoAudio },
+                                   { "--frames", BootCommands_Command_Frames },
+                                   { "--record", BootCommands_Command_Record },
+                                   { "--replay", BootCommands_Command_Replay } };
 
 void BootCommands_Init()
 {
@@ -71,3 +83,65 @@ BootCommandFunc BootCommands_Command_LoadFileSelect(char** argv, s32 argc) {
     gLoadFileSelect = 1;
     return 0;
 }
+
+/*
+ * Command Name: --headless
+ * Description: Runs game logic without presenting frames or playing audio
+ * Arguments: None
+ */
+BootCommandFunc BootCommands_Command_Headless(char** argv, s32 argc) {
+    HeadlessMode_SetHeadless(true);
+    return 0;
+}
+
+/*
+ * Command Name: --noaudio
+ * Description: Skips audio synthesis while running headless
+ * Arguments: None
+ */
+BootCommandFunc BootCommands_Command_NoAudio(char** argv, s32 argc) {
+    HeadlessMode_SetAudioEnabled(false);
+    return 0;
+}
+
+/*
+ * Command Name: --frames
+ * Description: Exits after the given number of game ticks while running headless
+ * Arguments: The number of ticks to run
+ */
+BootCommandFunc BootCommands_Command_Frames(char** argv, s32 argc) {
+    if (argc < 2) {
+        return 0;
+    }
+
+    HeadlessMode_SetFrameLimit(strtoul(argv[1], NULL, 10));
+    return 1;
+}
+
+/*
+ * Command Name: --record
+ * Description: Records controller input to a file
+ * Arguments: The path of the recording
+ */
+BootCommandFunc BootCommands_Command_Record(char** argv, s32 argc) {
+    if (argc < 2) {
+        return 0;
+    }
+
+    HeadlessMode_StartRecording(argv[1]);
+    return 1;
+}
+
+/*
+ * Command Name: --replay
+ * Description: Replays controller input from a file made with --record
+ * Arguments: The path of the recording
+ */
+BootCommandFunc BootCommands_Command_Replay(char** argv, s32 argc) {
+    if (argc < 2) {
+        return 0;
+    }
+
+    HeadlessMode_StartReplay(argv[1]);
+    return 1;
+}
@@ -1,12 +1,16 @@
 #pragma once
 #include <libultraship/libultraship.h>
 
+// Each expansion owns a static GfxPatchSite, so the target instruction is only looked up by name once
 #define PATCH_GFX(path, name, cvar, index, instruction) \
-    if (CVarGetInteger(cvar, 0)) { \
-        ResourceMgr_PatchGfxByName(path, name, index, instruction); \
-    } else { \
-        ResourceMgr_UnpatchGfxByName(path, name); \
-    }
+    do { \
+        static GfxPatchSite patchSite; \
+        if (CVarGetInteger(cvar, 0)) { \
+            ResourceMgr_PatchGfxSite(&patchSite, path, index, instruction); \
+        } else { \
+            ResourceMgr_UnpatchGfxSite(&patchSite); \
+        } \
+    } while (0)
 
 typedef struct {
     const std::string Name;
@@ -19,6 +19,7 @@ extern "C" {
 #include "functions.h"
 #include "macros.h"
 extern PlayState* gPlayState;
+extern ActorDrawStats gActorDrawStats;
 
 #include "textures/icon_item_static/icon_item_static.h"
 #include "textures/icon_item_24_static/icon_item_24_static.h"
@@ -393,6 +394,21 @@ void ActorViewerWindow::DrawElement() {
             ActorViewer_AddTagForAllActors();
         }
         UIWidgets::Tooltip("Adds \"name tags\" above actors for identification");
+
+        if (ImGui::TreeNode("Draw Stats")) {
+            ImGui::Text("Considered: %u", gActorDrawStats.considered);
+            ImGui::Text("Culled: %u", gActorDrawStats.culled);
+            ImGui::Text("Drawn: %u", gActorDrawStats.drawn);
+            ImGui::Text("Light sets reused: %u", gActorDrawStats.lightsElided);
+            ImGui::Text("Display list bytes saved: %u", gActorDrawStats.bytesSaved);
+            ImGui::TreePop();
+        }
+
+        if (ImGui::TreeNode("Effect Stats")) {
+            ImGui::Text("Active soft sprite effects: %d", EffectSs_GetNumActive());
+            ImGui::Text("High water mark this scene: %d", EffectSs_GetHighWaterMark());
+            ImGui::TreePop();
+        }
     } else {
         ImGui::Text("Global Context needed for actor info!");
         if (needs_reset) {
@@ -1,6 +1,7 @@
 #include "colViewer.h"
 #include "../../frame_interpolation.h"
 #include "../../UIWidgets.hpp"
+#include "soh/Enhancements/game-interactor/GameInteractor.h"
 
 #include <vector>
 #include <string>
@@ -282,9 +283,17 @@ void CreateSphereData() {
     sphereGfx.push_back(gsSPEndDisplayList());
 }
 
+void ClearDynapolyCaches();
+
 void ColViewerWindow::InitElement() {
     CreateCylinderData();
     CreateSphereData();
+
+    // Collision headers can be reallocated at the same address on a scene reload, so the caches can't key on the
+    // pointer alone across scenes
+    GameInteractor::Instance->RegisterGameHook<GameInteractor::OnSceneInit>([](int16_t sceneNum) {
+        ClearDynapolyCaches();
+    });
 }
 
 // Initializes the display list for a ColRenderSetting
@@ -331,18 +340,80 @@ void InitGfx(std::vector<Gfx>& gfx, ColRenderSetting setting) {
     gfx.push_back(gsDPSetEnvColor(0xFF, 0xFF, 0xFF, alpha));
 }
 
-// Draws a dynapoly structure (scenes or Bg Actors)
-void DrawDynapoly(std::vector<Gfx>& dl, CollisionHeader* col, int32_t bgId) {
-    uint32_t colorR = CVarGetInteger("gColViewerColorNormalR", 255);
-    uint32_t colorG = CVarGetInteger("gColViewerColorNormalG", 255);
-    uint32_t colorB = CVarGetInteger("gColViewerColorNormalB", 255);
-    uint32_t colorA = 255;
+// Surface colors used when drawing dynapoly structures, packed as RGBA so a change can be detected with a compare
+struct DynapolyColors {
+    uint32_t normal;
+    uint32_t hookshot;
+    uint32_t interactable;
+    uint32_t voidOut;
+    uint32_t entrance;
+    uint32_t specialSurface;
+    uint32_t slope;
+
+    bool operator==(const DynapolyColors&) const = default;
+};
+
+// Cached display list for a dynapoly structure. Vertices are in the structure's local space, so a Bg Actor only
+// needs its matrix rebuilt when it moves.
+struct DynapolyCache {
+    CollisionHeader* colHeader = nullptr;
+    DynapolyColors colors = {};
+    std::vector<Gfx> gfx;
+    std::vector<Vtx> vtx;
+    ScaleRotPos transform = {};
+    Mtx mtx;
+};
+
+static DynapolyCache sceneColCache;
+static DynapolyCache bgActorColCache[BG_ACTOR_MAX];
+
+void ClearDynapolyCaches() {
+    sceneColCache.colHeader = nullptr;
+    for (DynapolyCache& cache : bgActorColCache) {
+        cache.colHeader = nullptr;
+    }
+}
+
+// Compared field by field, memcmp would also compare the padding after rot
+static bool ScaleRotPosEqual(const ScaleRotPos& a, const ScaleRotPos& b) {
+    return a.scale.x == b.scale.x && a.scale.y == b.scale.y && a.scale.z == b.scale.z && a.rot.x == b.rot.x &&
+           a.rot.y == b.rot.y && a.rot.z == b.rot.z && a.pos.x == b.pos.x && a.pos.y == b.pos.y && a.pos.z == b.pos.z;
+}
 
-    uint32_t lastColorR = colorR;
-    uint32_t lastColorG = colorG;
-    uint32_t lastColorB = colorB;
+static uint32_t GetColViewerColor(const char* cvarName, uint8_t defaultR, uint8_t defaultG, uint8_t defaultB) {
+    std::string name = cvarName;
+    uint32_t r = CVarGetInteger((name + "R").c_str(), defaultR);
+    uint32_t g = CVarGetInteger((name + "G").c_str(), defaultG);
+    uint32_t b = CVarGetInteger((name + "B").c_str(), defaultB);
+    return (r << 24) | (g << 16) | (b << 8) | 0xFF;
+}
 
-    dl.push_back(gsDPSetPrimColor(0, 0, colorR, colorG, colorB, colorA));
+static DynapolyColors GetDynapolyColors() {
+    return {
+        GetColViewerColor("gColViewerColorNormal", 255, 255, 255),
+        GetColViewerColor("gColViewerColorHookshot", 128, 128, 255),
+        GetColViewerColor("gColViewerColorInteractable", 192, 0, 192),
+        GetColViewerColor("gColViewerColorVoid", 255, 0, 0),
+        GetColViewerColor("gColViewerColorEntrance", 0, 255, 0),
+        GetColViewerColor("gColViewerColorSpecialSurface", 192, 255, 192),
+        GetColViewerColor("gColViewerColorSlope", 255, 255, 128),
+    };
+}
+
+// Builds the display list for a dynapoly structure (scenes or Bg Actors) into its cache
+void DrawDynapoly(DynapolyCache& cache, CollisionHeader* col, int32_t bgId, const DynapolyColors& colors) {
+    std::vector<Gfx>& dl = cache.gfx;
+    std::vector<Vtx>& vtx = cache.vtx;
+
+    cache.colHeader = col;
+    cache.colors = colors;
+    dl.clear();
+    vtx.clear();
+    // Every poly adds exactly three vertices, reserving up front keeps the pointers in the display list valid
+    vtx.reserve(col->numPolygons * 3);
+
+    uint32_t lastColor = colors.normal;
+    dl.push_back(gsDPSetPrimColor(0, 0, lastColor >> 24, (lastColor >> 16) & 0xFF, (lastColor >> 8) & 0xFF, 255));
 
     // This keeps track of if we have processed a poly, but not drawn it yet so we can batch them.
     // This saves several hundred commands in larger scenes
@@ -350,67 +421,52 @@ void DrawDynapoly(std::vector<Gfx>& dl, CollisionHeader* col, int32_t bgId) {
 
     for (int i = 0; i < col->numPolygons; i++) {
         CollisionPoly* poly = &col->polyList[i];
+        uint32_t color;
 
         if (SurfaceType_IsHookshotSurface(&gPlayState->colCtx, poly, bgId)) {
-            colorR = CVarGetInteger("gColViewerColorHookshotR", 128);
-            colorG = CVarGetInteger("gColViewerColorHookshotG", 128);
-            colorB = CVarGetInteger("gColViewerColorHookshotB", 255);
+            color = colors.hookshot;
         } else if (func_80041D94(&gPlayState->colCtx, poly, bgId) > 0x01) {
-            colorR = CVarGetInteger("gColViewerColorInteractableR", 192);
-            colorG = CVarGetInteger("gColViewerColorInteractableG", 0);
-            colorB = CVarGetInteger("gColViewerColorInteractableB", 192);
+            color = colors.interactable;
         } else if (func_80041E80(&gPlayState->colCtx, poly, bgId) == 0x0C) {
-            colorR = CVarGetInteger("gColViewerColorVoidR", 255);
-            colorG = CVarGetInteger("gColViewerColorVoidG", 0);
-            colorB = CVarGetInteger("gColViewerColorVoidB", 0);
+            color = colors.voidOut;
         } else if (SurfaceType_GetSceneExitIndex(&gPlayState->colCtx, poly, bgId) ||
                    func_80041E80(&gPlayState->colCtx, poly, bgId) == 0x05) {
-            colorR = CVarGetInteger("gColViewerColorEntranceR", 0);
-            colorG = CVarGetInteger("gColViewerColorEntranceG", 255);
-            colorB = CVarGetInteger("gColViewerColorEntranceB", 0);
+            color = colors.entrance;
         } else if (func_80041D4C(&gPlayState->colCtx, poly, bgId) != 0 ||
                    SurfaceType_IsWallDamage(&gPlayState->colCtx, poly, bgId)) {
-            colorR = CVarGetInteger("gColViewerColorSpecialSurfaceR", 192);
-            colorG = CVarGetInteger("gColViewerColorSpecialSurfaceG", 255);
-            colorB = CVarGetInteger("gColViewerColorSpecialSurfaceB", 192);
+            color = colors.specialSurface;
         } else if (SurfaceType_GetSlope(&gPlayState->colCtx, poly, bgId) == 0x01) {
-            colorR = CVarGetInteger("gColViewerColorSlopeR", 255);
-            colorG = CVarGetInteger("gColViewerColorSlopeG", 255);
-            colorB = CVarGetInteger("gColViewerColorSlopeB", 128);
+            color = colors.slope;
         } else {
-            colorR = CVarGetInteger("gColViewerColorNormalR", 255);
-            colorG = CVarGetInteger("gColViewerColorNormalG", 255);
-            colorB = CVarGetInteger("gColViewerColorNormalB", 255);
+            color = colors.normal;
         }
 
-        if (colorR != lastColorR || colorG != lastColorG || colorB != lastColorB) {
+        if (color != lastColor) {
             // Color changed, flush previous poly
             if (previousPoly) {
-                dl.push_back(gsSPVertex((uintptr_t)&vtxDl.at(vtxDl.size() - 3), 3, 0));
+                dl.push_back(gsSPVertex((uintptr_t)&vtx.at(vtx.size() - 3), 3, 0));
                 dl.push_back(gsSP1Triangle(0, 1, 2, 0));
                 previousPoly = false;
             }
-            dl.push_back(gsDPSetPrimColor(0, 0, colorR, colorG, colorB, colorA));
+            dl.push_back(gsDPSetPrimColor(0, 0, color >> 24, (color >> 16) & 0xFF, (color >> 8) & 0xFF, 255));
         }
-        lastColorR = colorR;
-        lastColorG = colorG;
-        lastColorB = colorB;
+        lastColor = color;
 
         Vec3s* va = &col->vtxList[COLPOLY_VTX_INDEX(poly->flags_vIA)];
         Vec3s* vb = &col->vtxList[COLPOLY_VTX_INDEX(poly->flags_vIB)];
         Vec3s* vc = &col->vtxList[COLPOLY_VTX_INDEX(poly->vIC)];
-        vtxDl.push_back(gdSPDefVtxN(va->x, va->y, va->z, 0, 0, (signed char)(poly->normal.x / 0x100),
-                                    (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
-                                    0xFF));
-        vtxDl.push_back(gdSPDefVtxN(vb->x, vb->y, vb->z, 0, 0, (signed char)(poly->normal.x / 0x100),
-                                    (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
-                                    0xFF));
-        vtxDl.push_back(gdSPDefVtxN(vc->x, vc->y, vc->z, 0, 0, (signed char)(poly->normal.x / 0x100),
-                                    (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
-                                    0xFF));
+        vtx.push_back(gdSPDefVtxN(va->x, va->y, va->z, 0, 0, (signed char)(poly->normal.x / 0x100),
+                                  (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
+                                  0xFF));
+        vtx.push_back(gdSPDefVtxN(vb->x, vb->y, vb->z, 0, 0, (signed char)(poly->normal.x / 0x100),
+                                  (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
+                                  0xFF));
+        vtx.push_back(gdSPDefVtxN(vc->x, vc->y, vc->z, 0, 0, (signed char)(poly->normal.x / 0x100),
+                                  (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
+                                  0xFF));
 
         if (previousPoly) {
-            dl.push_back(gsSPVertex((uintptr_t)&vtxDl.at(vtxDl.size() - 6), 6, 0));
+            dl.push_back(gsSPVertex((uintptr_t)&vtx.at(vtx.size() - 6), 6, 0));
             dl.push_back(gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0));
             previousPoly = false;
         } else {
@@ -420,14 +476,16 @@ void DrawDynapoly(std::vector<Gfx>& dl, CollisionHeader* col, int32_t bgId) {
 
     // Flush previous poly if this is the end and there's no more coming
     if (previousPoly) {
-        dl.push_back(gsSPVertex((uintptr_t)&vtxDl.at(vtxDl.size() - 3), 3, 0));
+        dl.push_back(gsSPVertex((uintptr_t)&vtx.at(vtx.size() - 3), 3, 0));
         dl.push_back(gsSP1Triangle(0, 1, 2, 0));
         previousPoly = false;
     }
+
+    dl.push_back(gsSPEndDisplayList());
 }
 
 // Draws the scene
-void DrawSceneCollision() {
+void DrawSceneCollision(const DynapolyColors& colors) {
     ColRenderSetting showSceneColSetting = (ColRenderSetting)CVarGetInteger("gColViewerScene", COLVIEW_DISABLED);
 
     if (showSceneColSetting == ColRenderSetting::Disabled || !CVarGetInteger("gColViewerEnabled", 0)) {
@@ -438,11 +496,17 @@ void DrawSceneCollision() {
     InitGfx(dl, showSceneColSetting);
     dl.push_back(gsSPMatrix(&gMtxClear, G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH));
 
-    DrawDynapoly(dl, gPlayState->colCtx.colHeader, BGCHECK_SCENE);
+    // Scene collision only changes on scene load, so it is only rebuilt when the header or colors change
+    CollisionHeader* colHeader = gPlayState->colCtx.colHeader;
+    if (sceneColCache.colHeader != colHeader || sceneColCache.colors != colors) {
+        DrawDynapoly(sceneColCache, colHeader, BGCHECK_SCENE, colors);
+    }
+
+    dl.push_back(gsSPDisplayList(sceneColCache.gfx.data()));
 }
 
 // Draws all Bg Actors
-void DrawBgActorCollision() {
+void DrawBgActorCollision(const DynapolyColors& colors) {
     ColRenderSetting showBgActorSetting = (ColRenderSetting)CVarGetInteger("gColViewerBgActors", COLVIEW_DISABLED);
     if (showBgActorSetting == ColRenderSetting::Disabled || !CVarGetInteger("gColViewerEnabled", 0)) {
         return;
@@ -453,21 +517,35 @@ void DrawBgActorCollision() {
     dl.push_back(gsSPMatrix(&gMtxClear, G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH));
 
     for (int32_t bgIndex = 0; bgIndex < BG_ACTOR_MAX; bgIndex++) {
+        DynapolyCache& cache = bgActorColCache[bgIndex];
+
         if (gPlayState->colCtx.dyna.bgActorFlags[bgIndex] & 1) {
             BgActor& bg = gPlayState->colCtx.dyna.bgActors[bgIndex];
-            Mtx m;
-            MtxF mf;
-            SkinMatrix_SetTranslateRotateYXZScale(&mf, bg.curTransform.scale.x, bg.curTransform.scale.y,
-                                                  bg.curTransform.scale.z, bg.curTransform.rot.x, bg.curTransform.rot.y,
-                                                  bg.curTransform.rot.z, bg.curTransform.pos.x, bg.curTransform.pos.y,
-                                                  bg.curTransform.pos.z);
-            guMtxF2L(&mf, &m);
-            mtxDl.push_back(m);
-            dl.push_back(gsSPMatrix(&mtxDl.back(), G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_PUSH));
-
-            DrawDynapoly(dl, bg.colHeader, bgIndex);
+            bool rebuilt = false;
 
+            if (cache.colHeader != bg.colHeader || cache.colors != colors) {
+                DrawDynapoly(cache, bg.colHeader, bgIndex, colors);
+                rebuilt = true;
+            }
+
+            // Only recompute the matrix when the Bg Actor has moved
+            if (rebuilt || !ScaleRotPosEqual(cache.transform, bg.curTransform)) {
+                MtxF mf;
+                SkinMatrix_SetTranslateRotateYXZScale(&mf, bg.curTransform.scale.x, bg.curTransform.scale.y,
+                                                      bg.curTransform.scale.z, bg.curTransform.rot.x,
+                                                      bg.curTransform.rot.y, bg.curTransform.rot.z,
+                                                      bg.curTransform.pos.x, bg.curTransform.pos.y,
+                                                      bg.curTransform.pos.z);
+                guMtxF2L(&mf, &cache.mtx);
+                cache.transform = bg.curTransform;
+            }
+
+            dl.push_back(gsSPMatrix(&cache.mtx, G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_PUSH));
+            dl.push_back(gsSPDisplayList(cache.gfx.data()));
             dl.push_back(gsSPPopMatrix(G_MTX_MODELVIEW));
+        } else {
+            // Drop the cache of free slots so a new Bg Actor reusing the slot never draws stale geometry
+            cache.colHeader = nullptr;
         }
     }
 }
@@ -660,13 +738,15 @@ extern "C" void DrawColViewer() {
         return;
     }
 
+    DynapolyColors colors = GetDynapolyColors();
+
     ResetVector(opaDl);
     ResetVector(xluDl);
     size_t vtxDlCapacity = ResetVector(vtxDl);
     size_t mtxDlCapacity = ResetVector(mtxDl);
 
-    DrawSceneCollision();
-    DrawBgActorCollision();
+    DrawSceneCollision(colors);
+    DrawBgActorCollision(colors);
     DrawColCheckCollision();
     DrawWaterboxList();
 
@@ -679,8 +759,8 @@ extern "C" void DrawColViewer() {
         vtxDlCapacity = ResetVector(vtxDl);
         mtxDlCapacity = ResetVector(mtxDl);
 
-        DrawSceneCollision();
-        DrawBgActorCollision();
+        DrawSceneCollision(colors);
+        DrawBgActorCollision(colors);
         DrawColCheckCollision();
         DrawWaterboxList();
     }
@@ -0,0 +1,169 @@
+#include "HeadlessMode.h"
+
+#include <cstdio>
+#include <cstring>
+#include <libultraship/libultraship.h>
+
+extern "C" uint64_t GetFrequency();
+extern "C" uint64_t GetPerfCounter();
+
+#define INPUT_REPLAY_MAGIC 0x534F4852 // "SOHR"
+#define INPUT_REPLAY_VERSION 1
+#define INPUT_REPLAY_CONTROLLERS 4
+
+// Ticks between benchmark reports
+#define HEADLESS_REPORT_INTERVAL 600
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t padSize;
+    uint32_t numControllers;
+} InputReplayHeader;
+
+static bool sHeadless = false;
+static bool sAudioEnabled = true;
+static uint32_t sFrameLimit = 0;
+static bool sStopRequested = false;
+
+static FILE* sRecordFile = nullptr;
+static FILE* sReplayFile = nullptr;
+
+static uint32_t sFrameCount = 0;
+static uint64_t sStartTicks = 0;
+
+extern "C" void HeadlessMode_SetHeadless(uint8_t headless) {
+    sHeadless = headless;
+}
+
+extern "C" void HeadlessMode_SetAudioEnabled(uint8_t enabled) {
+    sAudioEnabled = enabled;
+}
+
+extern "C" void HeadlessMode_SetFrameLimit(uint32_t frames) {
+    sFrameLimit = frames;
+}
+
+extern "C" uint8_t HeadlessMode_IsHeadless() {
+    return sHeadless;
+}
+
+extern "C" uint8_t HeadlessMode_IsAudioEnabled() {
+    return !sHeadless || sAudioEnabled;
+}
+
+extern "C" uint8_t HeadlessMode_IsDeterministic() {
+    return sRecordFile != nullptr || sReplayFile != nullptr;
+}
+
+extern "C" uint8_t HeadlessMode_StartRecording(const char* path) {
+    if (sRecordFile != nullptr || sReplayFile != nullptr) {
+        SPDLOG_ERROR("[Headless] Can not record while another recording or replay is active");
+        return false;
+    }
+
+    sRecordFile = fopen(path, "wb");
+    if (sRecordFile == nullptr) {
+        SPDLOG_ERROR("[Headless] Failed to open {} for recording", path);
+        return false;
+    }
+
+    InputReplayHeader header = { INPUT_REPLAY_MAGIC, INPUT_REPLAY_VERSION, sizeof(OSContPad),
+                                 INPUT_REPLAY_CONTROLLERS };
+    fwrite(&header, sizeof(header), 1, sRecordFile);
+    SPDLOG_INFO("[Headless] Recording input to {}", path);
+    return true;
+}
+
+extern "C" uint8_t HeadlessMode_StartReplay(const char* path) {
+    if (sRecordFile != nullptr || sReplayFile != nullptr) {
+        SPDLOG_ERROR("[Headless] Can not replay while another recording or replay is active");
+        return false;
+    }
+
+    sReplayFile = fopen(path, "rb");
+    if (sReplayFile == nullptr) {
+        SPDLOG_ERROR("[Headless] Failed to open {} for replay", path);
+        return false;
+    }
+
+    InputReplayHeader header;
+    if (fread(&header, sizeof(header), 1, sReplayFile) != 1 || header.magic != INPUT_REPLAY_MAGIC ||
+        header.version != INPUT_REPLAY_VERSION || header.padSize != sizeof(OSContPad) ||
+        header.numControllers != INPUT_REPLAY_CONTROLLERS) {
+        SPDLOG_ERROR("[Headless] {} is not a compatible input recording", path);
+        fclose(sReplayFile);
+        sReplayFile = nullptr;
+        return false;
+    }
+
+    SPDLOG_INFO("[Headless] Replaying input from {}", path);
+    return true;
+}
+
+extern "C" void HeadlessMode_ProcessPads(OSContPad* pads) {
+    if (sRecordFile != nullptr) {
+        fwrite(pads, sizeof(OSContPad), INPUT_REPLAY_CONTROLLERS, sRecordFile);
+        return;
+    }
+
+    if (sReplayFile != nullptr) {
+        if (fread(pads, sizeof(OSContPad), INPUT_REPLAY_CONTROLLERS, sReplayFile) != INPUT_REPLAY_CONTROLLERS) {
+            SPDLOG_INFO("[Headless] Input replay finished after {} frames", sFrameCount);
+            fclose(sReplayFile);
+            sReplayFile = nullptr;
+            memset(pads, 0, sizeof(OSContPad) * INPUT_REPLAY_CONTROLLERS);
+
+            // A headless replay has nothing left to do once the input runs out
+            if (sHeadless) {
+                sStopRequested = true;
+            }
+        }
+    }
+}
+
+static void HeadlessMode_Report(uint64_t now) {
+    double seconds = (double)(now - sStartTicks) / GetFrequency();
+    SPDLOG_INFO("[Headless] {} ticks in {:.3f}s ({:.1f} ticks/s)", sFrameCount, seconds,
+                seconds > 0.0 ? sFrameCount / seconds : 0.0);
+}
+
+extern "C" void HeadlessMode_EndFrame() {
+    if (!sHeadless) {
+        return;
+    }
+
+    uint64_t now = GetPerfCounter();
+    if (sFrameCount == 0) {
+        sStartTicks = now;
+    }
+    sFrameCount++;
+
+    if (sFrameCount % HEADLESS_REPORT_INTERVAL == 0) {
+        HeadlessMode_Report(now);
+    }
+
+    if (sFrameLimit != 0 && sFrameCount >= sFrameLimit) {
+        sStopRequested = true;
+    }
+}
+
+extern "C" uint8_t HeadlessMode_ShouldStop() {
+    return sStopRequested;
+}
+
+extern "C" void HeadlessMode_Shutdown() {
+    if (sHeadless && sFrameCount != 0) {
+        HeadlessMode_Report(GetPerfCounter());
+    }
+
+    if (sRecordFile != nullptr) {
+        fclose(sRecordFile);
+        sRecordFile = nullptr;
+    }
+
+    if (sReplayFile != nullptr) {
+        fclose(sReplayFile);
+        sReplayFile = nullptr;
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <libultraship/libultra.h>
+
+// Headless mode runs game logic without presenting frames. Display lists are still built by Graph_Update but are
+// not executed, and audio synthesis can be turned off. Combined with input replay this allows benchmarking logic
+// ticks per second and running deterministic regression replays without a person at the controls.
+//
+// Controller input can be recorded to and replayed from a file. While recording or replaying the game RNG is seeded
+// with a fixed value so a replay reproduces the recorded session.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void HeadlessMode_SetHeadless(uint8_t headless);
+void HeadlessMode_SetAudioEnabled(uint8_t enabled);
+void HeadlessMode_SetFrameLimit(uint32_t frames);
+uint8_t HeadlessMode_IsHeadless();
+uint8_t HeadlessMode_IsAudioEnabled();
+uint8_t HeadlessMode_IsDeterministic();
+
+uint8_t HeadlessMode_StartRecording(const char* path);
+uint8_t HeadlessMode_StartReplay(const char* path);
+
+// Records or overrides the raw controller data read by the pad manager for this frame
+void HeadlessMode_ProcessPads(OSContPad* pads);
+// Called once per game tick after the frame has been processed
+void HeadlessMode_EndFrame();
+// Set once the frame limit is reached or a headless replay runs out of input. The headless frame loop then returns so
+// the process exits through the normal DeinitOTR shutdown path.
+uint8_t HeadlessMode_ShouldStop();
+void HeadlessMode_Shutdown();
+
+#ifdef __cplusplus
+};
+#endif
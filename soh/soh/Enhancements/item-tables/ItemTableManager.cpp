@@ -1,5 +1,6 @@
 #include "ItemTableManager.h"
-#include <stdexcept>
+
+const GetItemEntry ItemTableManager::MissingItemEntry = GET_ITEM_NONE;
 
 ItemTableManager::ItemTableManager() {
 }
@@ -9,37 +10,74 @@ ItemTableManager::~ItemTableManager() {
 }
 
 bool ItemTableManager::AddItemTable(uint16_t tableID) {
-    ItemTable newItemTable;
-    return itemTables.emplace(tableID, newItemTable).second;
+    if (tableID >= itemTables.size()) {
+        itemTables.resize(tableID + 1, ItemTable{ false });
+    }
+    if (itemTables[tableID].registered) {
+        return false;
+    }
+    itemTables[tableID].registered = true;
+    return true;
 }
 
 bool ItemTableManager::AddItemEntry(uint16_t tableID, uint16_t getItemID, GetItemEntry getItemEntry) {
-    try {
-        ItemTable* itemTable = RetrieveItemTable(tableID);
-        return itemTable->emplace(getItemID, getItemEntry).second;
-    } catch (const std::out_of_range& oor) { return false; }
+    ItemTable* itemTable = RetrieveItemTable(tableID);
+    if (itemTable == nullptr) {
+        return false;
+    }
+    if (getItemID >= itemTable->entries.size()) {
+        itemTable->entries.resize(getItemID + 1, MissingItemEntry);
+        itemTable->present.resize(getItemID + 1, false);
+    }
+    if (itemTable->present[getItemID]) {
+        return false;
+    }
+    // Entries are handed out with their draw IDs matching their item, so store them that way
+    getItemEntry.drawItemId = getItemEntry.itemId;
+    getItemEntry.drawModIndex = getItemEntry.modIndex;
+    itemTable->entries[getItemID] = getItemEntry;
+    itemTable->present[getItemID] = true;
+    return true;
 }
 
 GetItemEntry ItemTableManager::RetrieveItemEntry(uint16_t tableID, uint16_t getItemID) {
-    try {
-        ItemTable* itemTable = RetrieveItemTable(tableID);
-        GetItemEntry getItemEntry = itemTable->at(getItemID);
-        getItemEntry.drawItemId = getItemEntry.itemId;
-        getItemEntry.drawModIndex = getItemEntry.modIndex;
-        return getItemEntry;
-    } catch (std::out_of_range& oor) { return GET_ITEM_NONE; }
+    return RetrieveItemEntryRef(tableID, getItemID);
+}
+
+const GetItemEntry& ItemTableManager::RetrieveItemEntryRef(uint16_t tableID, uint16_t getItemID) const {
+    const ItemTable* itemTable = RetrieveItemTable(tableID);
+    if (itemTable == nullptr || getItemID >= itemTable->entries.size()) {
+        return MissingItemEntry;
+    }
+    // Unregistered slots inside the table already hold MissingItemEntry
+    return itemTable->entries[getItemID];
+}
+
+bool ItemTableManager::HasItemEntry(uint16_t tableID, uint16_t getItemID) const {
+    const ItemTable* itemTable = RetrieveItemTable(tableID);
+    return itemTable != nullptr && getItemID < itemTable->present.size() && itemTable->present[getItemID];
 }
 
 bool ItemTableManager::ClearItemTable(uint16_t tableID) {
-    try {
-        ItemTable* itemTable = RetrieveItemTable(tableID);
-        itemTable->clear();
-        return true;
-    } catch (const std::out_of_range& oor) { return false; }
+    ItemTable* itemTable = RetrieveItemTable(tableID);
+    if (itemTable == nullptr) {
+        return false;
+    }
+    itemTable->entries.clear();
+    itemTable->present.clear();
+    return true;
 }
 
 ItemTable* ItemTableManager::RetrieveItemTable(uint16_t tableID) {
-    try {
-        return &itemTables.at(tableID);
-    } catch (const std::out_of_range& oor) { throw(oor); }
+    if (tableID >= itemTables.size() || !itemTables[tableID].registered) {
+        return nullptr;
+    }
+    return &itemTables[tableID];
+}
+
+const ItemTable* ItemTableManager::RetrieveItemTable(uint16_t tableID) const {
+    if (tableID >= itemTables.size() || !itemTables[tableID].registered) {
+        return nullptr;
+    }
+    return &itemTables[tableID];
 }
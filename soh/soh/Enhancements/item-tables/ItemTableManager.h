@@ -2,22 +2,34 @@
 #include "ItemTableTypes.h"
 #include "z64item.h"
 
-#include <unordered_map>
+#include <vector>
 
-typedef std::unordered_map<uint16_t, GetItemEntry> ItemTable;
+// Dense table of entries indexed directly by getItemID. Tables grow to fit the
+// largest ID registered, and IDs that were never registered read as missing.
+typedef struct {
+    bool registered;
+    std::vector<GetItemEntry> entries;
+    std::vector<bool> present;
+} ItemTable;
 
 class ItemTableManager {
   public:
       static ItemTableManager* Instance;
+      // Returned by RetrieveItemEntryRef when the table or entry doesn't exist
+      static const GetItemEntry MissingItemEntry;
       ItemTableManager();
       ~ItemTableManager();
       bool AddItemTable(uint16_t tableID);
       bool AddItemEntry(uint16_t tableID, uint16_t getItemID, GetItemEntry getItemEntry);
       GetItemEntry RetrieveItemEntry(uint16_t tableID, uint16_t getItemID);
+      const GetItemEntry& RetrieveItemEntryRef(uint16_t tableID, uint16_t getItemID) const;
+      bool HasItemEntry(uint16_t tableID, uint16_t getItemID) const;
       bool ClearItemTable(uint16_t tableID);
 
   private:
-      std::unordered_map<uint16_t, ItemTable> itemTables;
+      // Indexed by tableID (usually a ModIndex)
+      std::vector<ItemTable> itemTables;
 
       ItemTable* RetrieveItemTable(uint16_t tableID);
+      const ItemTable* RetrieveItemTable(uint16_t tableID) const;
 };
@@ -2786,7 +2786,7 @@ GetItemEntry Randomizer::GetItemEntryFromRGData(RandomizerGetData rgData, GetIte
         } else {
             modIndex = MOD_RANDOMIZER;
         }
-        GetItemEntry fakeGiEntry = ItemTableManager::Instance->RetrieveItemEntry(modIndex, GetItemIdFromRandomizerGet(rgData.fakeRgID, ogItemId));
+        const GetItemEntry& fakeGiEntry = ItemTableManager::Instance->RetrieveItemEntryRef(modIndex, GetItemIdFromRandomizerGet(rgData.fakeRgID, ogItemId));
         giEntry.gid = fakeGiEntry.gid;
         giEntry.gi = fakeGiEntry.gi;
         giEntry.drawItemId = fakeGiEntry.drawItemId;
@@ -2,6 +2,7 @@
 #include "soh/OTRGlobals.h"
 #include "soh/UIWidgets.hpp"
 
+#include <cstring>
 #include <map>
 #include <string>
 #include <vector>
@@ -36,6 +37,40 @@ static s16 lastEntranceIndex = -1;
 static s16 currentGrottoId = -1;
 static s16 lastSceneOrEntranceDetected = -1;
 
+typedef struct {
+    EntranceOverride entrance;
+    const EntranceData* original;
+    const EntranceData* override;
+    bool isDiscovered;
+} TrackerEntrance;
+
+typedef struct {
+    std::vector<const TrackerEntrance*> displayEntrances;
+    size_t undiscovered;
+} TrackerEntranceGroup;
+
+// Everything that decides which entrances are listed, so the filtered groups can be reused between frames
+struct TrackerEntranceFilter {
+    uint8_t groupType;
+    bool showTo;
+    bool showFrom;
+    bool collapseUndiscovered;
+    bool hideReverse;
+    bool decoupled;
+    std::string search;
+
+    bool operator==(const TrackerEntranceFilter&) const = default;
+};
+
+// Sorted entrance lists resolved against entranceData, indexed by TrackerEntranceGroupingType
+static std::vector<TrackerEntrance> sortedEntrances[TRACKER_GROUP_TYPE_COUNT];
+// Copy of the discovered entrance bits that the isDiscovered flags in sortedEntrances were taken from
+static u32 trackedEntrancesDiscovered[SAVEFILE_ENTRANCES_DISCOVERED_IDX_COUNT] = { 0 };
+// Filtered groups for the current tracker settings, only rebuilt when the filter or discovered entrances change
+static std::vector<TrackerEntranceGroup> displayGroups;
+static TrackerEntranceFilter displayFilter;
+static bool displayGroupsDirty = true;
+
 static std::string spoilerEntranceGroupNames[] = {
     "Spawns/Warp Songs/Owls",
     "Kokiri Forest",
@@ -421,7 +456,26 @@ bool IsEntranceDiscovered(s16 index) {
     return isDiscovered;
 }
 
+// Direct lookup from an entrance index to its entranceData entry, built on first use
+static const EntranceData* entranceDataByIndex[MAX_ENTRANCE_RANDO_USED_INDEX + 1] = { nullptr };
+static bool entranceDataByIndexBuilt = false;
+
 const EntranceData* GetEntranceData(s16 index) {
+    if (!entranceDataByIndexBuilt) {
+        // Walk backwards so the first entry for an index wins, matching a front to back search
+        for (size_t i = ARRAY_COUNT(entranceData); i-- > 0;) {
+            s16 dataIndex = entranceData[i].index;
+            if (dataIndex >= 0 && dataIndex <= MAX_ENTRANCE_RANDO_USED_INDEX) {
+                entranceDataByIndex[dataIndex] = &entranceData[i];
+            }
+        }
+        entranceDataByIndexBuilt = true;
+    }
+
+    if (index >= 0 && index <= MAX_ENTRANCE_RANDO_USED_INDEX) {
+        return entranceDataByIndex[index];
+    }
+
     for (size_t i = 0; i < ARRAY_COUNT(entranceData); i++) {
         if (index == entranceData[i].index) {
             return &entranceData[i];
@@ -554,15 +608,103 @@ void SetLastEntranceOverrideForTracker(s16 entranceIndex) {
     lastEntranceIndex = entranceIndex;
 }
 
+static void ClearTrackerEntranceViews() {
+    for (size_t i = 0; i < TRACKER_GROUP_TYPE_COUNT; i++) {
+        sortedEntrances[i].clear();
+    }
+    memset(trackedEntrancesDiscovered, 0, sizeof(trackedEntrancesDiscovered));
+    displayGroups.clear();
+    displayGroupsDirty = true;
+}
+
+// Re-reads the discovered state for every sorted entrance, called whenever the save's discovered bits change
+static void RefreshDiscoveredEntrances() {
+    memcpy(trackedEntrancesDiscovered, gSaveContext.sohStats.entrancesDiscovered, sizeof(trackedEntrancesDiscovered));
+
+    for (size_t i = 0; i < TRACKER_GROUP_TYPE_COUNT; i++) {
+        for (auto& trackerEntrance : sortedEntrances[i]) {
+            trackerEntrance.isDiscovered = IsEntranceDiscovered(trackerEntrance.entrance.index);
+        }
+    }
+
+    displayGroupsDirty = true;
+}
+
+static void BuildDisplayGroups(const TrackerEntranceFilter& filter, const ImGuiTextFilter& locationSearch, size_t groupCount) {
+    uint8_t destToggle = filter.groupType & 1;
+    const std::vector<TrackerEntrance>& entranceList = sortedEntrances[filter.groupType];
+
+    displayGroups.assign(groupCount, TrackerEntranceGroup{});
+
+    for (size_t i = 0; i < groupCount; i++) {
+        TrackerEntranceGroup& group = displayGroups[i];
+
+        uint16_t entranceCount = gEntranceTrackingData.GroupEntranceCounts[filter.groupType][i];
+        uint16_t startIndex = gEntranceTrackingData.GroupOffsets[filter.groupType][i];
+
+        for (size_t entranceIdx = 0; entranceIdx < entranceCount; entranceIdx++) {
+            size_t trueIdx = entranceIdx + startIndex;
+            if (trueIdx >= entranceList.size()) {
+                break;
+            }
+
+            const TrackerEntrance& trackerEntrance = entranceList[trueIdx];
+            const EntranceData* original = trackerEntrance.original;
+            const EntranceData* override = trackerEntrance.override;
+
+            // If entrance is a dungeon, grotto, or interior entrance, the transition into that area has oneExit set, which means we can filter the return transitions as redundant
+            // if entrances are not decoupled, as this is redundant information. Also checks a setting, enabled by default, for hiding them.
+            // If all of these conditions are met, we skip adding this entrance to any lists.
+            // However, if entrances are decoupled, then all transitions need to be displayed, so we proceed with the filtering
+            if ((original->type == ENTRANCE_TYPE_DUNGEON || original->type == ENTRANCE_TYPE_GROTTO || original->type == ENTRANCE_TYPE_INTERIOR) &&
+                (original->oneExit != 1 && !filter.decoupled) && filter.hideReverse) {
+                    continue;
+            }
+
+            bool isDiscovered = trackerEntrance.isDiscovered;
+
+            bool showOriginal = (!destToggle ? filter.showTo : filter.showFrom) || isDiscovered;
+            bool showOverride = (!destToggle ? filter.showFrom : filter.showTo) || isDiscovered;
+
+            const char* origSrcAreaName = spoilerEntranceGroupNames[original->srcGroup].c_str();
+            const char* origTypeName = groupTypeNames[original->type].c_str();
+            const char* rplcSrcAreaName = spoilerEntranceGroupNames[override->srcGroup].c_str();
+            const char* rplcTypeName = groupTypeNames[override->type].c_str();
+
+            const char* origSrcName = showOriginal ? original->source.c_str()      : "";
+            const char* origDstName = showOriginal ? original->destination.c_str() : "";
+            const char* rplcSrcName = showOverride ? override->source.c_str()      : "";
+            const char* rplcDstName = showOverride ? override->destination.c_str() : "";
+
+            // Filter for entrances by group name, type, source/destination names, and meta tags
+            if ((!locationSearch.IsActive() && (showOriginal || showOverride || !filter.collapseUndiscovered)) ||
+                ((showOriginal && (locationSearch.PassFilter(origSrcName) ||
+                locationSearch.PassFilter(origDstName) || locationSearch.PassFilter(origSrcAreaName) ||
+                locationSearch.PassFilter(origTypeName) || locationSearch.PassFilter(original->metaTag.c_str()))) ||
+                (showOverride && (locationSearch.PassFilter(rplcSrcName) ||
+                locationSearch.PassFilter(rplcDstName) || locationSearch.PassFilter(rplcSrcAreaName) ||
+                locationSearch.PassFilter(rplcTypeName) || locationSearch.PassFilter(override->metaTag.c_str()))))) {
+                group.displayEntrances.push_back(&trackerEntrance);
+            } else {
+                if (!isDiscovered) {
+                    group.undiscovered++;
+                }
+            }
+        }
+    }
+}
+
 void ClearEntranceTrackingData() {
     currentGrottoId = -1;
     lastEntranceIndex = -1;
     lastSceneOrEntranceDetected = -1;
     gEntranceTrackingData = {0};
+    ClearTrackerEntranceViews();
 }
 
 void InitEntranceTrackingData() {
     gEntranceTrackingData = {0};
+    ClearTrackerEntranceViews();
 
     // Check if entrance randomization is disabled
     if (!OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(RSK_SHUFFLE_ENTRANCES)) {
@@ -626,6 +768,22 @@ void InitEntranceTrackingData() {
     SortEntranceListByArea(destListSortedByArea, 1);
     SortEntranceListByType(srcListSortedByType, 0);
     SortEntranceListByType(destListSortedByType, 1);
+
+    // Resolve the sorted lists against entranceData once so the tracker doesn't look them up every frame
+    EntranceOverride* sortedLists[TRACKER_GROUP_TYPE_COUNT] = {
+        srcListSortedByArea,
+        destListSortedByArea,
+        srcListSortedByType,
+        destListSortedByType,
+    };
+    for (size_t i = 0; i < TRACKER_GROUP_TYPE_COUNT; i++) {
+        sortedEntrances[i].reserve(ENTRANCE_OVERRIDES_MAX_COUNT);
+        for (size_t j = 0; j < ENTRANCE_OVERRIDES_MAX_COUNT; j++) {
+            const EntranceOverride& entrance = sortedLists[i][j];
+            sortedEntrances[i].push_back({ entrance, GetEntranceData(entrance.index), GetEntranceData(entrance.override), false });
+        }
+    }
+    RefreshDiscoveredEntrances();
 }
 
 void EntranceTrackerWindow::DrawElement() {
@@ -749,89 +907,49 @@ void EntranceTrackerWindow::DrawElement() {
     size_t groupCount = groupToggle ? ENTRANCE_TYPE_COUNT : SPOILER_ENTRANCE_GROUP_COUNT;
     auto groupNames = groupToggle ? groupTypeNames : spoilerEntranceGroupNames;
 
-    EntranceOverride *entranceList;
+    bool showTo = CVarGetInteger("gEntranceTrackerShowTo", 0);
+    bool showFrom = CVarGetInteger("gEntranceTrackerShowFrom", 0);
+    bool isDecoupled = OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(RSK_DECOUPLED_ENTRANCES) == RO_GENERIC_ON;
 
-    switch (groupType) {
-        case ENTRANCE_SOURCE_AREA:
-            entranceList = srcListSortedByArea;
-            break;
-        case ENTRANCE_DESTINATION_AREA:
-            entranceList = destListSortedByArea;
-            break;
-        case ENTRANCE_SOURCE_TYPE:
-            entranceList = srcListSortedByType;
-            break;
-        case ENTRANCE_DESTINATION_TYPE:
-            entranceList = destListSortedByType;
-            break;
+    // Entrances are discovered from game code, so pick that up by comparing against the bits the views were built from
+    if (memcmp(trackedEntrancesDiscovered, gSaveContext.sohStats.entrancesDiscovered, sizeof(trackedEntrancesDiscovered)) != 0) {
+        RefreshDiscoveredEntrances();
     }
 
+    TrackerEntranceFilter filter = {
+        groupType,
+        showTo,
+        showFrom,
+        (bool)CVarGetInteger("gEntranceTrackerCollapseUndiscovered", 0),
+        CVarGetInteger("gEntranceTrackerHideReverseEntrances", 1) == 1,
+        isDecoupled,
+        locationSearch.InputBuf,
+    };
+    if (displayGroupsDirty || !(filter == displayFilter)) {
+        BuildDisplayGroups(filter, locationSearch, groupCount);
+        displayFilter = filter;
+        displayGroupsDirty = false;
+    }
+
+    bool highlightPrevious = CVarGetInteger("gEntranceTrackerHighlightPrevious", 0);
+    bool highlightAvailable = CVarGetInteger("gEntranceTrackerHighlightAvailable", 0);
+    bool autoScroll = CVarGetInteger("gEntranceTrackerAutoScroll", 0);
+
     // Begin tracker list
     ImGui::BeginChild("ChildEntranceTrackerLocations", ImVec2(0, -8));
     for (size_t i = 0; i < groupCount; i++) {
-        std::string groupName = groupNames[i];
-
-        uint16_t entranceCount = gEntranceTrackingData.GroupEntranceCounts[groupType][i];
-        uint16_t startIndex = gEntranceTrackingData.GroupOffsets[groupType][i];
+        const std::string& groupName = groupNames[i];
+        const std::vector<const TrackerEntrance*>& displayEntrances = displayGroups[i].displayEntrances;
+        size_t undiscovered = displayGroups[i].undiscovered;
 
+        // Detect if a scroll should happen and remember the scene for that scroll
         bool doAreaScroll = false;
-        size_t undiscovered = 0;
-        std::vector<EntranceOverride> displayEntrances = {};
-
-        // Loop over entrances first for filtering
-        for (size_t entranceIdx = 0; entranceIdx < entranceCount; entranceIdx++) {
-            size_t trueIdx = entranceIdx + startIndex;
-
-            EntranceOverride entrance = entranceList[trueIdx];
-
-            const EntranceData* original = GetEntranceData(entrance.index);
-            const EntranceData* override = GetEntranceData(entrance.override);
-
-            // If entrance is a dungeon, grotto, or interior entrance, the transition into that area has oneExit set, which means we can filter the return transitions as redundant
-            // if entrances are not decoupled, as this is redundant information. Also checks a setting, enabled by default, for hiding them.
-            // If all of these conditions are met, we skip adding this entrance to any lists.
-            // However, if entrances are decoupled, then all transitions need to be displayed, so we proceed with the filtering
-            if ((original->type == ENTRANCE_TYPE_DUNGEON || original->type == ENTRANCE_TYPE_GROTTO || original->type == ENTRANCE_TYPE_INTERIOR) &&
-                (original->oneExit != 1 && OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(RSK_DECOUPLED_ENTRANCES) == RO_GENERIC_OFF) &&
-                CVarGetInteger("gEntranceTrackerHideReverseEntrances", 1) == 1) {
-                    continue;
-            }
-
-            bool isDiscovered = IsEntranceDiscovered(entrance.index);
-
-            bool showOriginal = (!destToggle ? CVarGetInteger("gEntranceTrackerShowTo", 0) : CVarGetInteger("gEntranceTrackerShowFrom", 0)) || isDiscovered;
-            bool showOverride = (!destToggle ? CVarGetInteger("gEntranceTrackerShowFrom", 0) : CVarGetInteger("gEntranceTrackerShowTo", 0)) || isDiscovered;
-
-            const char* origSrcAreaName = spoilerEntranceGroupNames[original->srcGroup].c_str();
-            const char* origTypeName = groupTypeNames[original->type].c_str();
-            const char* rplcSrcAreaName = spoilerEntranceGroupNames[override->srcGroup].c_str();
-            const char* rplcTypeName = groupTypeNames[override->type].c_str();
-
-            const char* origSrcName = showOriginal ? original->source.c_str()      : "";
-            const char* origDstName = showOriginal ? original->destination.c_str() : "";
-            const char* rplcSrcName = showOverride ? override->source.c_str()      : "";
-            const char* rplcDstName = showOverride ? override->destination.c_str() : "";
-
-            // Filter for entrances by group name, type, source/destination names, and meta tags
-            if ((!locationSearch.IsActive() && (showOriginal || showOverride || !CVarGetInteger("gEntranceTrackerCollapseUndiscovered", 0))) ||
-                ((showOriginal && (locationSearch.PassFilter(origSrcName) ||
-                locationSearch.PassFilter(origDstName) || locationSearch.PassFilter(origSrcAreaName) ||
-                locationSearch.PassFilter(origTypeName) || locationSearch.PassFilter(original->metaTag.c_str()))) ||
-                (showOverride && (locationSearch.PassFilter(rplcSrcName) ||
-                locationSearch.PassFilter(rplcDstName) || locationSearch.PassFilter(rplcSrcAreaName) ||
-                locationSearch.PassFilter(rplcTypeName) || locationSearch.PassFilter(override->metaTag.c_str()))))) {
-
-                // Detect if a scroll should happen and remember the scene for that scroll
-                if (!doAreaScroll && (lastSceneOrEntranceDetected != LinkIsInArea(original) && LinkIsInArea(original) != -1)) {
-                    lastSceneOrEntranceDetected = LinkIsInArea(original);
-                    doAreaScroll = true;
-                }
-
-                displayEntrances.push_back(entrance);
-            } else {
-                if (!isDiscovered) {
-                    undiscovered++;
-                }
+        for (const TrackerEntrance* trackerEntrance : displayEntrances) {
+            s8 linkArea = LinkIsInArea(trackerEntrance->original);
+            if (linkArea != -1 && lastSceneOrEntranceDetected != linkArea) {
+                lastSceneOrEntranceDetected = linkArea;
+                doAreaScroll = true;
+                break;
             }
         }
 
@@ -845,14 +963,14 @@ void EntranceTrackerWindow::DrawElement() {
             }
 
             if (ImGui::TreeNode(groupName.c_str())) {
-                for (auto entrance : displayEntrances) {
-                    const EntranceData* original = GetEntranceData(entrance.index);
-                    const EntranceData* override = GetEntranceData(entrance.override);
+                for (const TrackerEntrance* trackerEntrance : displayEntrances) {
+                    const EntranceData* original = trackerEntrance->original;
+                    const EntranceData* override = trackerEntrance->override;
 
-                    bool isDiscovered = IsEntranceDiscovered(entrance.index);
+                    bool isDiscovered = trackerEntrance->isDiscovered;
 
-                    bool showOriginal = (!destToggle ? CVarGetInteger("gEntranceTrackerShowTo", 0) : CVarGetInteger("gEntranceTrackerShowFrom", 0)) || isDiscovered;
-                    bool showOverride = (!destToggle ? CVarGetInteger("gEntranceTrackerShowFrom", 0) : CVarGetInteger("gEntranceTrackerShowTo", 0)) || isDiscovered;
+                    bool showOriginal = (!destToggle ? showTo : showFrom) || isDiscovered;
+                    bool showOverride = (!destToggle ? showFrom : showTo) || isDiscovered;
 
                     const char* unknown = "???";
 
@@ -865,17 +983,17 @@ void EntranceTrackerWindow::DrawElement() {
 
                     // Handle highlighting and auto scroll
                     if ((original->index == lastEntranceIndex ||
-                        (override->reverseIndex == lastEntranceIndex && OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(RSK_DECOUPLED_ENTRANCES) == RO_GENERIC_OFF)) &&
-                            CVarGetInteger("gEntranceTrackerHighlightPrevious", 0)) {
+                        (override->reverseIndex == lastEntranceIndex && !isDecoupled)) &&
+                            highlightPrevious) {
                                  color = COLOR_ORANGE;
                     } else if (LinkIsInArea(original) != -1) {
-                        if (CVarGetInteger("gEntranceTrackerHighlightAvailable", 0)) {
+                        if (highlightAvailable) {
                             color = COLOR_GREEN;
                         }
 
                         if (doAreaScroll) {
                             doAreaScroll = false;
-                            if (CVarGetInteger("gEntranceTrackerAutoScroll", 0)) {
+                            if (autoScroll) {
                                 ImGui::SetScrollHereY(0.0f);
                             }
                         }
@@ -23,12 +23,12 @@ extern PlayState* gPlayState;
 }
 extern "C" uint32_t ResourceMgr_IsSceneMasterQuest(s16 sceneNum);
 
-void DrawEquip(ItemTrackerItem item);
-void DrawItem(ItemTrackerItem item);
-void DrawDungeonItem(ItemTrackerItem item);
-void DrawBottle(ItemTrackerItem item);
-void DrawQuest(ItemTrackerItem item);
-void DrawSong(ItemTrackerItem item);
+void DrawEquip(const ItemTrackerItem& item);
+void DrawItem(const ItemTrackerItem& item);
+void DrawDungeonItem(const ItemTrackerItem& item);
+void DrawBottle(const ItemTrackerItem& item);
+void DrawQuest(const ItemTrackerItem& item);
+void DrawSong(const ItemTrackerItem& item);
 
 bool shouldUpdateVectors = true;
 
@@ -292,19 +292,19 @@ bool IsValidSaveFile() {
     return validSave;
 }
 
-bool HasSong(ItemTrackerItem item) {
+bool HasSong(const ItemTrackerItem& item) {
     return (1 << item.id) & gSaveContext.inventory.questItems;
 }
 
-bool HasQuestItem(ItemTrackerItem item) {
+bool HasQuestItem(const ItemTrackerItem& item) {
     return (item.data & gSaveContext.inventory.questItems) != 0;
 }
 
-bool HasEquipment(ItemTrackerItem item) {
+bool HasEquipment(const ItemTrackerItem& item) {
     return (item.data & gSaveContext.inventory.equipment) != 0;
 }
 
-ItemTrackerNumbers GetItemCurrentAndMax(ItemTrackerItem item) {
+ItemTrackerNumbers GetItemCurrentAndMax(const ItemTrackerItem& item) {
     ItemTrackerNumbers result;
     result.currentCapacity = 0;
     result.maxCapacity = 0;
@@ -410,43 +410,129 @@ ItemTrackerNumbers GetItemCurrentAndMax(ItemTrackerItem item) {
 #define IM_COL_GRAY IM_COL32(155, 155, 155, 255)
 #define IM_COL_PURPLE IM_COL32(180, 90, 200, 255)
 
-void DrawItemCount(ItemTrackerItem item) {
-    int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
+/**
+ * Tracker model
+ * Everything a tile shows is derived from the save context once per change and cached here, so drawing
+ * only reads precomputed state. The model generation is bumped from item/flag/load hooks, and a small
+ * fingerprint of the save fields the tiles read catches mutations that don't go through a hook
+ * (ammo use, rupees, the save editor).
+ */
+struct ItemTrackerTileState {
+    uint32_t generation = 0;
+    std::string textureName;
+    std::string hoverText;
+    bool hasCount = false;
+    bool countAlignLeft = false;
+    std::string countCurrent;
+    std::string countMax;
+    std::string countText;
+    ImU32 countCurrentColor = IM_COL_WHITE;
+    ImU32 countMaxColor = IM_COL_GREEN;
+    std::string dungeonName;
+    ImU32 dungeonColor = IM_COL_WHITE;
+};
+
+typedef void (*ItemTrackerDrawFunc)(const ItemTrackerItem&);
+
+struct ItemTrackerTileKey {
+    ItemTrackerDrawFunc drawFunc;
+    uint32_t id;
+    uint32_t data;
+
+    bool operator==(const ItemTrackerTileKey& other) const = default;
+};
+
+struct ItemTrackerTileKeyHash {
+    size_t operator()(const ItemTrackerTileKey& key) const {
+        return std::hash<uint64_t>()(((uint64_t)key.id << 32) | key.data) ^ std::hash<void*>()((void*)key.drawFunc);
+    }
+};
+
+struct ItemTrackerModelFingerprint {
+    Inventory inventory;
+    int32_t fileNum;
+    int16_t rupees;
+    int8_t magicLevel;
+    uint8_t questId;
+    uint8_t heartPieces;
+    uint8_t heartContainers;
+    uint8_t collectedKeys[19];
+    uint8_t triforcePiecesCollected;
+    bool gregFound;
+    bool saveLoaded;
+    int32_t capacityTrack;
+    int32_t keyTrack;
+    int32_t currentOnLeft;
+    int32_t triforcePieceTrack;
+};
+
+static std::unordered_map<ItemTrackerTileKey, ItemTrackerTileState, ItemTrackerTileKeyHash> itemTrackerTileStates;
+static ItemTrackerModelFingerprint itemTrackerModelFingerprint;
+static uint32_t itemTrackerModelGeneration = 1;
+
+void InvalidateItemTrackerModel() {
+    itemTrackerModelGeneration++;
+}
+
+void RefreshItemTrackerModel() {
+    ItemTrackerModelFingerprint fingerprint;
+    // Zeroed first so padding bytes don't make memcmp report spurious changes
+    memset(&fingerprint, 0, sizeof(fingerprint));
+    fingerprint.inventory = gSaveContext.inventory;
+    fingerprint.fileNum = gSaveContext.fileNum;
+    fingerprint.rupees = gSaveContext.rupees;
+    fingerprint.magicLevel = gSaveContext.magicLevel;
+    fingerprint.questId = gSaveContext.questId;
+    fingerprint.heartPieces = gSaveContext.sohStats.heartPieces;
+    fingerprint.heartContainers = gSaveContext.sohStats.heartContainers;
+    memcpy(fingerprint.collectedKeys, gSaveContext.sohStats.dungeonKeys, sizeof(fingerprint.collectedKeys));
+    fingerprint.triforcePiecesCollected = gSaveContext.triforcePiecesCollected;
+    fingerprint.gregFound = Flags_GetRandomizerInf(RAND_INF_GREG_FOUND);
+    fingerprint.saveLoaded = GameInteractor::IsSaveLoaded();
+    fingerprint.capacityTrack = CVarGetInteger("gItemTrackerCapacityTrack", ITEM_TRACKER_NUMBER_CURRENT_CAPACITY_ONLY);
+    fingerprint.keyTrack = CVarGetInteger("gItemTrackerKeyTrack", KEYS_COLLECTED_MAX);
+    fingerprint.currentOnLeft = CVarGetInteger("gItemTrackerCurrentOnLeft", 0);
+    fingerprint.triforcePieceTrack = CVarGetInteger("gItemTrackerTriforcePieceTrack", TRIFORCE_PIECE_COLLECTED_REQUIRED_MAX);
+
+    if (memcmp(&fingerprint, &itemTrackerModelFingerprint, sizeof(fingerprint)) != 0) {
+        itemTrackerModelFingerprint = fingerprint;
+        InvalidateItemTrackerModel();
+    }
+}
+
+void SetTileTexture(ItemTrackerTileState& state, const ItemTrackerItem& item, bool hasItem) {
+    state.textureName = hasItem && IsValidSaveFile() ? item.name : item.nameFaded;
+}
+
+void UpdateTileCount(ItemTrackerTileState& state, const ItemTrackerItem& item) {
     ItemTrackerNumbers currentAndMax = GetItemCurrentAndMax(item);
-    ImVec2 p = ImGui::GetCursorScreenPos();
-    int32_t trackerNumberDisplayMode = CVarGetInteger("gItemTrackerCapacityTrack", ITEM_TRACKER_NUMBER_CURRENT_CAPACITY_ONLY);
-    int32_t trackerKeyNumberDisplayMode = CVarGetInteger("gItemTrackerKeyTrack", KEYS_COLLECTED_MAX);
+    int32_t trackerNumberDisplayMode = itemTrackerModelFingerprint.capacityTrack;
+    int32_t trackerKeyNumberDisplayMode = itemTrackerModelFingerprint.keyTrack;
+
+    state.hasCount = false;
+    state.countAlignLeft = false;
+    state.countCurrent = "";
+    state.countMax = "";
+    state.countCurrentColor = IM_COL_WHITE;
+    state.countMaxColor = IM_COL_GREEN;
 
     if (item.id == ITEM_KEY_SMALL && IsValidSaveFile()) {
-        std::string currentString = "";
-        std::string maxString = std::to_string(currentAndMax.maxCapacity);
-        ImU32 currentColor = IM_COL_WHITE;
-        ImU32 maxColor = IM_COL_GREEN;
+        state.hasCount = true;
+        state.countMax = std::to_string(currentAndMax.maxCapacity);
         // "Collected / Max", "Current / Collected / Max", "Current / Max"
         if (trackerKeyNumberDisplayMode == KEYS_CURRENT_COLLECTED_MAX || trackerKeyNumberDisplayMode == KEYS_CURRENT_MAX) {
-            currentString+= std::to_string(currentAndMax.currentAmmo);
-            currentString+= "/";
+            state.countCurrent += std::to_string(currentAndMax.currentAmmo);
+            state.countCurrent += "/";
         }
         if (trackerKeyNumberDisplayMode == KEYS_COLLECTED_MAX || trackerKeyNumberDisplayMode == KEYS_CURRENT_COLLECTED_MAX) {
-            currentString+= std::to_string(currentAndMax.currentCapacity);
-            currentString+= "/";
+            state.countCurrent += std::to_string(currentAndMax.currentCapacity);
+            state.countCurrent += "/";
         }
-
-        ImGui::SetCursorScreenPos(ImVec2(p.x + (iconSize / 2) - (ImGui::CalcTextSize((currentString + maxString).c_str()).x / 2), p.y - 14));
-        ImGui::PushStyleColor(ImGuiCol_Text, currentColor);
-        ImGui::Text("%s", currentString.c_str());
-        ImGui::PopStyleColor();
-        ImGui::SameLine(0, 0.0f);
-        ImGui::PushStyleColor(ImGuiCol_Text, maxColor);
-        ImGui::Text("%s", maxString.c_str());
-        ImGui::PopStyleColor();
     } else if (currentAndMax.currentCapacity > 0 && trackerNumberDisplayMode != ITEM_TRACKER_NUMBER_NONE && IsValidSaveFile()) {
-        std::string currentString = "";
-        std::string maxString = "";
-        ImU32 currentColor = IM_COL_WHITE;
-        ImU32 maxColor = item.id == QUEST_SKULL_TOKEN ? IM_COL_RED : IM_COL_GREEN;
+        state.hasCount = true;
+        state.countMaxColor = item.id == QUEST_SKULL_TOKEN ? IM_COL_RED : IM_COL_GREEN;
 
-        bool shouldAlignToLeft = CVarGetInteger("gItemTrackerCurrentOnLeft", 0) &&
+        state.countAlignLeft = itemTrackerModelFingerprint.currentOnLeft &&
             trackerNumberDisplayMode != ITEM_TRACKER_NUMBER_CAPACITY &&
             trackerNumberDisplayMode != ITEM_TRACKER_NUMBER_AMMO;
 
@@ -462,114 +548,72 @@ void DrawItemCount(ItemTrackerItem item) {
         bool shouldDisplayMax = !(trackerNumberDisplayMode == ITEM_TRACKER_NUMBER_CURRENT_CAPACITY_ONLY || trackerNumberDisplayMode == ITEM_TRACKER_NUMBER_CURRENT_AMMO_ONLY);
 
         if (shouldDisplayAmmo) {
-            currentString = std::to_string(currentAndMax.currentAmmo);
+            state.countCurrent = std::to_string(currentAndMax.currentAmmo);
             if (currentAndMax.currentAmmo >= currentAndMax.currentCapacity) {
                 if (item.id == QUEST_SKULL_TOKEN) {
-                    currentColor = IM_COL_RED;
+                    state.countCurrentColor = IM_COL_RED;
                 } else {
-                    currentColor = IM_COL_GREEN;
+                    state.countCurrentColor = IM_COL_GREEN;
                 }
             }
             if (shouldDisplayMax) {
-                currentString += "/";
-                maxString = std::to_string(currentAndMax.currentCapacity);
+                state.countCurrent += "/";
+                state.countMax = std::to_string(currentAndMax.currentCapacity);
             }
             if (currentAndMax.currentAmmo <= 0) {
-                currentColor = IM_COL_GRAY;
+                state.countCurrentColor = IM_COL_GRAY;
             }
         } else {
-            currentString = std::to_string(currentAndMax.currentCapacity);
+            state.countCurrent = std::to_string(currentAndMax.currentCapacity);
             if (currentAndMax.currentCapacity >= currentAndMax.maxCapacity) {
-                currentColor = IM_COL_GREEN;
+                state.countCurrentColor = IM_COL_GREEN;
             } else if (shouldDisplayMax) {
-                currentString += "/";
-                maxString = std::to_string(currentAndMax.maxCapacity);
+                state.countCurrent += "/";
+                state.countMax = std::to_string(currentAndMax.maxCapacity);
             }
         }
-
-        float x = shouldAlignToLeft ? p.x : p.x + (iconSize / 2) - (ImGui::CalcTextSize((currentString + maxString).c_str()).x / 2);
-
-        ImGui::SetCursorScreenPos(ImVec2(x, p.y - 14));
-        ImGui::PushStyleColor(ImGuiCol_Text, currentColor);
-        ImGui::Text("%s", currentString.c_str());
-        ImGui::PopStyleColor();
-        ImGui::SameLine(0, 0.0f);
-        ImGui::PushStyleColor(ImGuiCol_Text, maxColor);
-        ImGui::Text("%s", maxString.c_str());
-        ImGui::PopStyleColor();
     } else if (item.id == RG_TRIFORCE_PIECE && IS_RANDO &&
                OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(RSK_TRIFORCE_HUNT) && IsValidSaveFile()) {
-        std::string currentString = "";
-        std::string requiredString = "";
-        std::string maxString = "";
         uint8_t piecesRequired = OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(RSK_TRIFORCE_HUNT_PIECES_REQUIRED);
         uint8_t piecesTotal = OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(RSK_TRIFORCE_HUNT_PIECES_TOTAL);
-        ImU32 currentColor = gSaveContext.triforcePiecesCollected >= piecesRequired ? IM_COL_GREEN : IM_COL_WHITE;
-        ImU32 maxColor = IM_COL_GREEN;
-        int32_t trackerTriforcePieceNumberDisplayMode = CVarGetInteger("gItemTrackerTriforcePieceTrack", TRIFORCE_PIECE_COLLECTED_REQUIRED_MAX);
+        int32_t trackerTriforcePieceNumberDisplayMode = itemTrackerModelFingerprint.triforcePieceTrack;
 
-        currentString += std::to_string(gSaveContext.triforcePiecesCollected);
-        currentString += "/";
+        state.hasCount = true;
+        state.countCurrentColor = gSaveContext.triforcePiecesCollected >= piecesRequired ? IM_COL_GREEN : IM_COL_WHITE;
+        state.countCurrent += std::to_string(gSaveContext.triforcePiecesCollected);
+        state.countCurrent += "/";
         // gItemTrackerTriforcePieceTrack
         if (trackerTriforcePieceNumberDisplayMode == TRIFORCE_PIECE_COLLECTED_REQUIRED_MAX) {
-            currentString += std::to_string(piecesRequired);
-            currentString += "/";
-            maxString += std::to_string(piecesTotal);
+            state.countCurrent += std::to_string(piecesRequired);
+            state.countCurrent += "/";
+            state.countMax += std::to_string(piecesTotal);
         } else if (trackerTriforcePieceNumberDisplayMode == TRIFORCE_PIECE_COLLECTED_REQUIRED) {
-            maxString += std::to_string(piecesRequired);
+            state.countMax += std::to_string(piecesRequired);
         }
-
-        ImGui::SetCursorScreenPos(
-            ImVec2(p.x + (iconSize / 2) - (ImGui::CalcTextSize((currentString + maxString).c_str()).x / 2), p.y - 14));
-        ImGui::PushStyleColor(ImGuiCol_Text, currentColor);
-        ImGui::Text(currentString.c_str());
-        ImGui::PopStyleColor();
-        ImGui::SameLine(0, 0.0f);
-        ImGui::PushStyleColor(ImGuiCol_Text, maxColor);
-        ImGui::Text(maxString.c_str());
-        ImGui::PopStyleColor();
-    } else {
-        ImGui::SetCursorScreenPos(ImVec2(p.x, p.y - 14));
-        ImGui::Text("");
     }
-}
 
-void DrawEquip(ItemTrackerItem item) {
-    bool hasEquip = HasEquipment(item);
-    int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
-    ImGui::Image(LUS::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(hasEquip && IsValidSaveFile() ? item.name : item.nameFaded),
-                 ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
-
-    UIWidgets::SetLastItemHoverText(SohUtils::GetItemName(item.id));
+    state.countText = state.countCurrent + state.countMax;
 }
 
-void DrawQuest(ItemTrackerItem item) {
-    bool hasQuestItem = HasQuestItem(item);
-    int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
-    ImGui::BeginGroup();
-    ImGui::Image(LUS::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(hasQuestItem && IsValidSaveFile() ? item.name : item.nameFaded),
-                 ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
+void UpdateEquipTile(ItemTrackerTileState& state, const ItemTrackerItem& item) {
+    SetTileTexture(state, item, HasEquipment(item));
+    state.hoverText = SohUtils::GetItemName(item.id);
+}
 
+void UpdateQuestTile(ItemTrackerTileState& state, const ItemTrackerItem& item) {
+    SetTileTexture(state, item, HasQuestItem(item));
     if (item.id == QUEST_SKULL_TOKEN) {
-        DrawItemCount(item);
+        UpdateTileCount(state, item);
     }
+    state.hoverText = SohUtils::GetQuestItemName(item.id);
+}
 
-    ImGui::EndGroup();
-
-    UIWidgets::SetLastItemHoverText(SohUtils::GetQuestItemName(item.id));
-};
-
-void DrawItem(ItemTrackerItem item) {
-
+void UpdateItemTile(ItemTrackerTileState& state, const ItemTrackerItem& item) {
     uint32_t actualItemId = INV_CONTENT(item.id);
-    int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
     bool hasItem = actualItemId != ITEM_NONE;
+    const ItemTrackerItem* displayItem = &item;
     std::string itemName = "";
 
-    if (item.id == ITEM_NONE) {
-        return;
-    }
-
     switch (item.id) {
         case ITEM_HEART_CONTAINER:
             actualItemId = item.id;
@@ -611,95 +655,180 @@ void DrawItem(ItemTrackerItem item) {
             break;
     }
 
-    if (GameInteractor::IsSaveLoaded() && (hasItem && item.id != actualItemId && actualItemTrackerItemMap.find(actualItemId) != actualItemTrackerItemMap.end())) {
-        item = actualItemTrackerItemMap[actualItemId];
+    if (GameInteractor::IsSaveLoaded() && hasItem && item.id != actualItemId) {
+        auto actualItem = actualItemTrackerItemMap.find(actualItemId);
+        if (actualItem != actualItemTrackerItemMap.end()) {
+            displayItem = &actualItem->second;
+        }
     }
-    
-    ImGui::BeginGroup();
 
-    ImGui::Image(LUS::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(hasItem && IsValidSaveFile() ? item.name : item.nameFaded),
-                 ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
-    
-    DrawItemCount(item);
-    ImGui::EndGroup();
+    SetTileTexture(state, *displayItem, hasItem);
+    UpdateTileCount(state, *displayItem);
+    state.hoverText = itemName == "" ? SohUtils::GetItemName(displayItem->id) : itemName;
+}
+
+void UpdateBottleTile(ItemTrackerTileState& state, const ItemTrackerItem& item) {
+    uint32_t actualItemId = gSaveContext.inventory.items[SLOT(item.id) + item.data];
+    bool hasItem = actualItemId != ITEM_NONE;
+    const ItemTrackerItem* displayItem = &item;
 
-    if (itemName == "") {
-        itemName = SohUtils::GetItemName(item.id);
+    if (GameInteractor::IsSaveLoaded() && hasItem && item.id != actualItemId) {
+        auto actualItem = actualItemTrackerItemMap.find(actualItemId);
+        if (actualItem != actualItemTrackerItemMap.end()) {
+            displayItem = &actualItem->second;
+        }
     }
 
-    UIWidgets::SetLastItemHoverText(itemName);
+    SetTileTexture(state, *displayItem, hasItem);
+    state.hoverText = SohUtils::GetItemName(displayItem->id);
 }
 
-void DrawBottle(ItemTrackerItem item) {
-    uint32_t actualItemId = gSaveContext.inventory.items[SLOT(item.id) + item.data];
-    bool hasItem = actualItemId != ITEM_NONE;
+void UpdateDungeonItemTile(ItemTrackerTileState& state, const ItemTrackerItem& item) {
+    if (item.id == ITEM_KEY_SMALL) {
+        SetTileTexture(state, item, gSaveContext.inventory.dungeonKeys[item.data] >= 0);
+        UpdateTileCount(state, item);
+    } else {
+        uint32_t bitMask = 1 << (item.id - ITEM_KEY_BOSS); // Bitset starts at ITEM_KEY_BOSS == 0. the rest are sequential
+        SetTileTexture(state, item, (bitMask & gSaveContext.inventory.dungeonItems[item.data]) != 0);
+    }
+
+    state.dungeonColor = IM_COL_WHITE;
+    if (ResourceMgr_IsSceneMasterQuest(item.data) && (CHECK_DUNGEON_ITEM(DUNGEON_MAP, item.data) || item.data == SCENE_GERUDO_TRAINING_GROUND || item.data == SCENE_INSIDE_GANONS_CASTLE)) {
+        state.dungeonColor = IM_COL_PURPLE;
+    }
+
+    auto dungeonName = itemTrackerDungeonShortNames.find(item.data);
+    state.dungeonName = dungeonName != itemTrackerDungeonShortNames.end() ? dungeonName->second : "";
+    state.hoverText = SohUtils::GetItemName(item.id);
+}
+
+void UpdateSongTile(ItemTrackerTileState& state, const ItemTrackerItem& item) {
+    SetTileTexture(state, item, HasSong(item));
+    state.hoverText = SohUtils::GetQuestItemName(item.id);
+}
 
-    if (GameInteractor::IsSaveLoaded() && (hasItem && item.id != actualItemId && actualItemTrackerItemMap.find(actualItemId) != actualItemTrackerItemMap.end())) {
-        item = actualItemTrackerItemMap[actualItemId];
+const ItemTrackerTileState& GetTileState(const ItemTrackerItem& item, void (*updateFunc)(ItemTrackerTileState&, const ItemTrackerItem&)) {
+    ItemTrackerTileState& state = itemTrackerTileStates[{ item.drawFunc, item.id, item.data }];
+    if (state.generation != itemTrackerModelGeneration) {
+        updateFunc(state, item);
+        state.generation = itemTrackerModelGeneration;
     }
+    return state;
+}
 
+void DrawItemCount(const ItemTrackerTileState& state) {
     int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
-    ImGui::Image(LUS::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(hasItem && IsValidSaveFile() ? item.name : item.nameFaded),
+    ImVec2 p = ImGui::GetCursorScreenPos();
+
+    if (state.hasCount) {
+        float x = state.countAlignLeft ? p.x : p.x + (iconSize / 2) - (ImGui::CalcTextSize(state.countText.c_str()).x / 2);
+
+        ImGui::SetCursorScreenPos(ImVec2(x, p.y - 14));
+        ImGui::PushStyleColor(ImGuiCol_Text, state.countCurrentColor);
+        ImGui::Text("%s", state.countCurrent.c_str());
+        ImGui::PopStyleColor();
+        ImGui::SameLine(0, 0.0f);
+        ImGui::PushStyleColor(ImGuiCol_Text, state.countMaxColor);
+        ImGui::Text("%s", state.countMax.c_str());
+        ImGui::PopStyleColor();
+    } else {
+        ImGui::SetCursorScreenPos(ImVec2(p.x, p.y - 14));
+        ImGui::Text("");
+    }
+}
+
+void DrawEquip(const ItemTrackerItem& item) {
+    const ItemTrackerTileState& state = GetTileState(item, UpdateEquipTile);
+    int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
+    ImGui::Image(LUS::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(state.textureName),
                  ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
 
-    UIWidgets::SetLastItemHoverText(SohUtils::GetItemName(item.id));
-};
+    UIWidgets::SetLastItemHoverText(state.hoverText);
+}
 
-void DrawDungeonItem(ItemTrackerItem item) {
-    uint32_t itemId = item.id;
-    ImU32 dungeonColor = IM_COL_WHITE;
-    uint32_t bitMask = 1 << (item.id - ITEM_KEY_BOSS); // Bitset starts at ITEM_KEY_BOSS == 0. the rest are sequential
+void DrawQuest(const ItemTrackerItem& item) {
+    const ItemTrackerTileState& state = GetTileState(item, UpdateQuestTile);
     int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
-    bool hasItem = (bitMask & gSaveContext.inventory.dungeonItems[item.data]) != 0;
-    bool hasSmallKey = (gSaveContext.inventory.dungeonKeys[item.data]) >= 0;
     ImGui::BeginGroup();
-    if (itemId == ITEM_KEY_SMALL) {
-        ImGui::Image(LUS::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(hasSmallKey && IsValidSaveFile() ? item.name : item.nameFaded),
-                     ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
-    }
-    else {
-        ImGui::Image(LUS::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(hasItem && IsValidSaveFile() ? item.name : item.nameFaded),
-                     ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
+    ImGui::Image(LUS::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(state.textureName),
+                 ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
+
+    if (item.id == QUEST_SKULL_TOKEN) {
+        DrawItemCount(state);
     }
 
-    if (ResourceMgr_IsSceneMasterQuest(item.data) && (CHECK_DUNGEON_ITEM(DUNGEON_MAP, item.data) || item.data == SCENE_GERUDO_TRAINING_GROUND || item.data == SCENE_INSIDE_GANONS_CASTLE)) {
-        dungeonColor = IM_COL_PURPLE;
+    ImGui::EndGroup();
+
+    UIWidgets::SetLastItemHoverText(state.hoverText);
+};
+
+void DrawItem(const ItemTrackerItem& item) {
+    if (item.id == ITEM_NONE) {
+        return;
     }
 
-    if (itemId == ITEM_KEY_SMALL) {
-        DrawItemCount(item);
+    const ItemTrackerTileState& state = GetTileState(item, UpdateItemTile);
+    int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
+
+    ImGui::BeginGroup();
+
+    ImGui::Image(LUS::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(state.textureName),
+                 ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
+    
+    DrawItemCount(state);
+    ImGui::EndGroup();
+
+    UIWidgets::SetLastItemHoverText(state.hoverText);
+}
+
+void DrawBottle(const ItemTrackerItem& item) {
+    const ItemTrackerTileState& state = GetTileState(item, UpdateBottleTile);
+    int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
+    ImGui::Image(LUS::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(state.textureName),
+                 ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
+
+    UIWidgets::SetLastItemHoverText(state.hoverText);
+};
+
+void DrawDungeonItem(const ItemTrackerItem& item) {
+    const ItemTrackerTileState& state = GetTileState(item, UpdateDungeonItemTile);
+    int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
+    ImGui::BeginGroup();
+    ImGui::Image(LUS::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(state.textureName),
+                 ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
+
+    if (item.id == ITEM_KEY_SMALL) {
+        DrawItemCount(state);
 
         ImVec2 p = ImGui::GetCursorScreenPos();
-        std::string dungeonName = itemTrackerDungeonShortNames[item.data];
-        ImGui::SetCursorScreenPos(ImVec2(p.x + (iconSize / 2) - (ImGui::CalcTextSize(dungeonName.c_str()).x / 2), p.y - (iconSize + 16)));
-        ImGui::PushStyleColor(ImGuiCol_Text, dungeonColor);
-        ImGui::Text("%s", dungeonName.c_str());
+        ImGui::SetCursorScreenPos(ImVec2(p.x + (iconSize / 2) - (ImGui::CalcTextSize(state.dungeonName.c_str()).x / 2), p.y - (iconSize + 16)));
+        ImGui::PushStyleColor(ImGuiCol_Text, state.dungeonColor);
+        ImGui::Text("%s", state.dungeonName.c_str());
         ImGui::PopStyleColor();
     }
 
-    if (itemId == ITEM_DUNGEON_MAP && 
+    if (item.id == ITEM_DUNGEON_MAP && 
         (item.data == SCENE_DEKU_TREE || item.data == SCENE_DODONGOS_CAVERN || item.data == SCENE_JABU_JABU || item.data == SCENE_ICE_CAVERN)
     ) {
         ImVec2 p = ImGui::GetCursorScreenPos();
-        std::string dungeonName = itemTrackerDungeonShortNames[item.data];
-        ImGui::SetCursorScreenPos(ImVec2(p.x + (iconSize / 2) - (ImGui::CalcTextSize(dungeonName.c_str()).x / 2), p.y - (iconSize + 13)));
-        ImGui::PushStyleColor(ImGuiCol_Text, dungeonColor);
-        ImGui::Text("%s", dungeonName.c_str());
+        ImGui::SetCursorScreenPos(ImVec2(p.x + (iconSize / 2) - (ImGui::CalcTextSize(state.dungeonName.c_str()).x / 2), p.y - (iconSize + 13)));
+        ImGui::PushStyleColor(ImGuiCol_Text, state.dungeonColor);
+        ImGui::Text("%s", state.dungeonName.c_str());
         ImGui::PopStyleColor();
     }
     ImGui::EndGroup();
 
-    UIWidgets::SetLastItemHoverText(SohUtils::GetItemName(item.id));
+    UIWidgets::SetLastItemHoverText(state.hoverText);
 }
 
-void DrawSong(ItemTrackerItem item) {
+void DrawSong(const ItemTrackerItem& item) {
+    const ItemTrackerTileState& state = GetTileState(item, UpdateSongTile);
     int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
     ImVec2 p = ImGui::GetCursorScreenPos();
-    bool hasSong = HasSong(item);
     ImGui::SetCursorScreenPos(ImVec2(p.x + 6, p.y));
-    ImGui::Image(LUS::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(hasSong && IsValidSaveFile() ? item.name : item.nameFaded),
+    ImGui::Image(LUS::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(state.textureName),
                  ImVec2(iconSize / 1.5, iconSize), ImVec2(0, 0), ImVec2(1, 1));
-    UIWidgets::SetLastItemHoverText(SohUtils::GetQuestItemName(item.id));
+    UIWidgets::SetLastItemHoverText(state.hoverText);
 }
 
 void DrawNotes(bool resizeable = false) {
@@ -772,7 +901,7 @@ void EndFloatingWindows() {
  * DrawItemsInRows
  * Takes in a vector of ItemTrackerItem and draws them in rows of N items
  */
-void DrawItemsInRows(std::vector<ItemTrackerItem> items, int columns = 6) {
+void DrawItemsInRows(const std::vector<ItemTrackerItem>& items, int columns = 6) {
     int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
     int iconSpacing = CVarGetInteger("gItemTrackerIconSpacing", 12);
     int topPadding = (CVarGetInteger("gItemTrackerWindowType", TRACKER_WINDOW_FLOATING) == TRACKER_WINDOW_WINDOW) ? 20 : 0;
@@ -789,7 +918,7 @@ void DrawItemsInRows(std::vector<ItemTrackerItem> items, int columns = 6) {
  * DrawItemsInACircle
  * Takes in a vector of ItemTrackerItem and draws them evenly spread across a circle
  */
-void DrawItemsInACircle(std::vector<ItemTrackerItem> items) {
+void DrawItemsInACircle(const std::vector<ItemTrackerItem>& items) {
     int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
     int iconSpacing = CVarGetInteger("gItemTrackerIconSpacing", 12);
 
@@ -919,7 +1048,7 @@ void UpdateVectors() {
     // and it doesn't already have greg, add him
     if (CVarGetInteger("gItemTrackerGregDisplayType", SECTION_DISPLAY_EXTENDED_HIDDEN) == SECTION_DISPLAY_EXTENDED_MISC_WINDOW &&
         CVarGetInteger("gItemTrackerMiscItemsDisplayType", SECTION_DISPLAY_MAIN_WINDOW) != SECTION_DISPLAY_MAIN_WINDOW &&
-        std::none_of(miscItems.begin(), miscItems.end(), [](ItemTrackerItem item){return item.id == ITEM_RUPEE_GREEN;})) {
+        std::none_of(miscItems.begin(), miscItems.end(), [](const ItemTrackerItem& item){return item.id == ITEM_RUPEE_GREEN;})) {
 
         miscItems.insert(miscItems.end(), gregItems.begin(), gregItems.end());
     } else {
@@ -961,6 +1090,7 @@ void UpdateVectors() {
 
 void ItemTrackerWindow::DrawElement() {
     UpdateVectors();
+    RefreshItemTrackerModel();
 
     int iconSize = CVarGetInteger("gItemTrackerIconSize", 36);
     int iconSpacing = CVarGetInteger("gItemTrackerIconSpacing", 12);
@@ -1233,4 +1363,23 @@ void ItemTrackerWindow::InitElement() {
         LUS::Context::GetInstance()->GetWindow()->GetGui()->SaveConsoleVariablesOnNextTick();
     });
     GameInteractor::Instance->RegisterGameHook<GameInteractor::OnGameFrameUpdate>(ItemTrackerOnFrame);
+    GameInteractor::Instance->RegisterGameHook<GameInteractor::OnLoadGame>([](int32_t fileNum) {
+        InvalidateItemTrackerModel();
+    });
+    GameInteractor::Instance->RegisterGameHook<GameInteractor::OnExitGame>([](int32_t fileNum) {
+        InvalidateItemTrackerModel();
+    });
+    GameInteractor::Instance->RegisterGameHook<GameInteractor::OnItemReceive>([](GetItemEntry itemEntry) {
+        InvalidateItemTrackerModel();
+    });
+    GameInteractor::Instance->RegisterGameHook<GameInteractor::OnFlagSet>([](int16_t flagType, int16_t flag) {
+        if (flagType == FLAG_RANDOMIZER_INF) {
+            InvalidateItemTrackerModel();
+        }
+    });
+    GameInteractor::Instance->RegisterGameHook<GameInteractor::OnFlagUnset>([](int16_t flagType, int16_t flag) {
+        if (flagType == FLAG_RANDOMIZER_INF) {
+            InvalidateItemTrackerModel();
+        }
+    });
 }
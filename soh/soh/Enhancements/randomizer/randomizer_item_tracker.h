@@ -12,12 +12,12 @@ typedef struct ItemTrackerItem {
     std::string name;
     std::string nameFaded;
     uint32_t data;
-    void (*drawFunc)(ItemTrackerItem);
+    void (*drawFunc)(const ItemTrackerItem&);
 } ItemTrackerItem;
 
-bool HasSong(ItemTrackerItem);
-bool HasQuestItem(ItemTrackerItem);
-bool HasEquipment(ItemTrackerItem);
+bool HasSong(const ItemTrackerItem&);
+bool HasQuestItem(const ItemTrackerItem&);
+bool HasEquipment(const ItemTrackerItem&);
 
 #define ITEM_TRACKER_ITEM(id, data, drawFunc)     \
     {                                             \
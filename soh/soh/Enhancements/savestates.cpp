@@ -972,5 +972,7 @@ void SaveState::Load(void) {
     LoadOnePointDemoData();
     LoadOverlayStaticData();
     LoadMiscCodeData();
+    // The soft sprite occupancy bitmap is static data derived from the restored effect table
+    EffectSs_RebuildOccupied();
 
 }
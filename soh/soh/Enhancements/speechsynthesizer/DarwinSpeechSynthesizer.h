@@ -14,11 +14,12 @@ class DarwinSpeechSynthesizer : public SpeechSynthesizer {
   public:
     DarwinSpeechSynthesizer();
 
-    void Speak(const char* text, const char* language);
-
   protected:
     bool DoInit(void);
     void DoUninitialize(void);
+    void DoSpeak(const char* text, const char* language);
+    // AVSpeechSynthesizer already speaks asynchronously, so skip the worker thread
+    bool SpeaksOnWorker(void) { return false; }
 
   private:
     void* mSynthesizer;
@@ -20,7 +20,7 @@ void DarwinSpeechSynthesizer::DoUninitialize() {
     mSynthesizer = nil;
 }
 
-void DarwinSpeechSynthesizer::Speak(const char* text, const char* language) {
+void DarwinSpeechSynthesizer::DoSpeak(const char* text, const char* language) {
     AVSpeechUtterance *utterance = [AVSpeechUtterance speechUtteranceWithString:@(text)];
     [utterance setVoice:[AVSpeechSynthesisVoice voiceWithLanguage:@(language)]];
 
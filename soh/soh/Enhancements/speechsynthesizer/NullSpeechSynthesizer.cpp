@@ -0,0 +1,19 @@
+//
+//  NullSpeechSynthesizer.cpp
+//  soh
+//
+
+#include "NullSpeechSynthesizer.h"
+
+NullSpeechSynthesizer::NullSpeechSynthesizer() {
+}
+
+bool NullSpeechSynthesizer::DoInit() {
+    return true;
+}
+
+void NullSpeechSynthesizer::DoUninitialize() {
+}
+
+void NullSpeechSynthesizer::DoSpeak(const char* text, const char* language) {
+}
@@ -0,0 +1,25 @@
+//
+//  NullSpeechSynthesizer.h
+//  soh
+//
+
+#ifndef SOHNullSpeechSynthesizer_h
+#define SOHNullSpeechSynthesizer_h
+
+#include "SpeechSynthesizer.h"
+
+// Discards everything it's asked to say. Used on platforms without a speech backend so callers always have an
+// instance to talk to.
+class NullSpeechSynthesizer : public SpeechSynthesizer {
+  public:
+    NullSpeechSynthesizer();
+
+  protected:
+    bool DoInit(void);
+    void DoUninitialize(void);
+    void DoSpeak(const char* text, const char* language);
+    // Nothing is spoken, so don't keep a worker thread around for it
+    bool SpeaksOnWorker(void) { return false; }
+};
+
+#endif /* SOHNullSpeechSynthesizer_h */
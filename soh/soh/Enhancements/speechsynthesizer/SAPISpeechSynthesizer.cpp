@@ -7,7 +7,6 @@
 
 #include "SAPISpeechSynthesizer.h"
 #include <sapi.h>
-#include <thread>
 #include <string>
 #include <spdlog/fmt/fmt.h>
 #include <spdlog/fmt/xchar.h>
@@ -37,7 +36,7 @@ std::wstring CharToWideString(std::string text) {
     return wstrTo;
 }
 
-void SpeakThreadTask(std::string text, std::string language) {
+void SAPISpeechSynthesizer::DoSpeak(const char* text, const char* language) {
     auto wText = CharToWideString(text);
     auto wLanguage = CharToWideString(language);
 
@@ -45,12 +44,3 @@ void SpeakThreadTask(std::string text, std::string language) {
         L"<speak version='1.0' xmlns='http://www.w3.org/2001/10/synthesis' xml:lang='{}'>{}</speak>", wLanguage, wText);
     ispVoice->Speak(speakText.c_str(), SPF_IS_XML | SPF_ASYNC | SPF_PURGEBEFORESPEAK, NULL);
 }
-
-void SAPISpeechSynthesizer::Speak(const char* text, const char* language) {
-    // convert to string so char buffers don't have to be kept alive by caller
-    std::string textStr(text);
-    std::string languageStr(language);
-
-    std::thread t1(SpeakThreadTask, textStr, languageStr);
-    t1.detach();
-}
@@ -15,11 +15,10 @@ class SAPISpeechSynthesizer : public SpeechSynthesizer {
   public:
     SAPISpeechSynthesizer();
 
-    void Speak(const char* text, const char* language);
-
   protected:
     bool DoInit(void);
     void DoUninitialize(void);
+    void DoSpeak(const char* text, const char* language);
 };
 
 #endif /* SAPISpeechSynthesizer_h */
@@ -7,7 +7,8 @@
 
 #include "SpeechSynthesizer.h"
 
-SpeechSynthesizer::SpeechSynthesizer() : mInitialized(false){};
+SpeechSynthesizer::SpeechSynthesizer()
+    : mInitialized(false), mWorkerRunning(false), mHasPending(false){};
 
 bool SpeechSynthesizer::Init(void) {
     if (mInitialized) {
@@ -15,6 +16,9 @@ bool SpeechSynthesizer::Init(void) {
     }
 
     mInitialized = DoInit();
+    if (mInitialized && SpeaksOnWorker()) {
+        StartWorker();
+    }
     return mInitialized;
 }
 
@@ -23,6 +27,7 @@ void SpeechSynthesizer::Uninitialize(void) {
         return;
     }
 
+    StopWorker();
     DoUninitialize();
     mInitialized = false;
 }
@@ -30,3 +35,66 @@ void SpeechSynthesizer::Uninitialize(void) {
 bool SpeechSynthesizer::IsInitialized(void) {
     return mInitialized;
 }
+
+void SpeechSynthesizer::Speak(const char* text, const char* language) {
+    if (!mInitialized) {
+        return;
+    }
+
+    if (!SpeaksOnWorker()) {
+        DoSpeak(text, language);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        // Copy into the pending slot so char buffers don't have to be kept alive by the caller
+        mPendingText.assign(text);
+        mPendingLanguage.assign(language);
+        mHasPending = true;
+    }
+    mWakeCondition.notify_one();
+}
+
+void SpeechSynthesizer::StartWorker(void) {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mWorkerRunning = true;
+        mHasPending = false;
+    }
+    mWorker = std::thread(&SpeechSynthesizer::WorkerLoop, this);
+}
+
+void SpeechSynthesizer::StopWorker(void) {
+    if (!mWorker.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mWorkerRunning = false;
+    }
+    mWakeCondition.notify_one();
+    mWorker.join();
+}
+
+void SpeechSynthesizer::WorkerLoop(void) {
+    std::string text;
+    std::string language;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWakeCondition.wait(lock, [this] { return mHasPending || !mWorkerRunning; });
+            if (!mWorkerRunning) {
+                return;
+            }
+            // Swap rather than copy so the strings' buffers get reused between utterances
+            text.swap(mPendingText);
+            language.swap(mPendingLanguage);
+            mHasPending = false;
+        }
+
+        DoSpeak(text.c_str(), language.c_str());
+    }
+}
@@ -9,24 +9,46 @@
 #define SOHSpeechSynthesizer_h
 
 #include <stdio.h>
+#include <stdint.h>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
 
 class SpeechSynthesizer {
   public:
     static SpeechSynthesizer* Instance;
     SpeechSynthesizer();
+    virtual ~SpeechSynthesizer() = default;
 
     bool Init(void);
     void Uninitialize(void);
-    virtual void Speak(const char* text, const char* language) = 0;
+    // Queues text to be spoken. Only the newest pending utterance is kept, as each one interrupts the last anyway.
+    void Speak(const char* text, const char* language);
 
     bool IsInitialized(void);
 
   protected:
     virtual bool DoInit(void) = 0;
     virtual void DoUninitialize(void) = 0;
+    virtual void DoSpeak(const char* text, const char* language) = 0;
+    // Backends whose native API is already asynchronous can speak directly from the caller's thread
+    virtual bool SpeaksOnWorker(void) { return true; }
 
   private:
+    void StartWorker(void);
+    void StopWorker(void);
+    void WorkerLoop(void);
+
     bool mInitialized;
+
+    std::thread mWorker;
+    std::mutex mMutex;
+    std::condition_variable mWakeCondition;
+    bool mWorkerRunning;
+    bool mHasPending;
+    std::string mPendingText;
+    std::string mPendingLanguage;
 };
 
 #endif /* SpeechSynthesizer_h */
@@ -35,4 +57,6 @@ class SpeechSynthesizer {
 #include "SAPISpeechSynthesizer.h"
 #elif defined(__APPLE__)
 #include "DarwinSpeechSynthesizer.h"
+#else
+#include "NullSpeechSynthesizer.h"
 #endif
@@ -6,6 +6,9 @@
 #include <libultraship/classes.h>
 #include <nlohmann/json.hpp>
 #include <spdlog/fmt/fmt.h>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
 
 #include "soh/OTRGlobals.h"
 #include "message_data_static.h"
@@ -23,70 +26,51 @@ typedef enum {
     /* 0x01 */ TEXT_BANK_MISC,
     /* 0x02 */ TEXT_BANK_KALEIDO,
     /* 0x03 */ TEXT_BANK_FILECHOOSE,
+    /* 0x04 */ TEXT_BANK_COUNT,
 } TextBank;
 
-nlohmann::json sceneMap = nullptr;
-nlohmann::json miscMap = nullptr;
-nlohmann::json kaleidoMap = nullptr;
-nlohmann::json fileChooseMap = nullptr;
+// A bank entry with its "$0" placeholder located once when the bank is loaded
+typedef struct {
+    std::string text;
+    size_t argPos; // std::string::npos when the text has no placeholder
+} TextTemplate;
+
+// Lets banks be searched with a string_view so lookups don't allocate a key
+struct TextBankKeyHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view key) const {
+        return std::hash<std::string_view>{}(key);
+    }
+};
 
-// MARK: - Helpers
+typedef std::unordered_map<std::string, TextTemplate, TextBankKeyHash, std::equal_to<>> TextBankTemplates;
 
-std::string GetParameritizedText(std::string key, TextBank bank, const char* arg) {
-    switch (bank) {
-        case TEXT_BANK_SCENES: {
-            return sceneMap[key].get<std::string>();
-            break;
-        }
-        case TEXT_BANK_MISC: {
-            auto value = miscMap[key].get<std::string>();
-            
-            std::string searchString = "$0";
-            size_t index = value.find(searchString);
-            
-            if (index != std::string::npos) {
-                assert(arg != nullptr);
-                value.replace(index, searchString.size(), std::string(arg));
-                return value;
-            } else {
-                return value;
-            }
-            
-            break;
-        }
-        case TEXT_BANK_KALEIDO: {
-            auto value = kaleidoMap[key].get<std::string>();
-            
-            std::string searchString = "$0";
-            size_t index = value.find(searchString);
-            
-            if (index != std::string::npos) {
-                assert(arg != nullptr);
-                value.replace(index, searchString.size(), std::string(arg));
-                return value;
-            } else {
-                return value;
-            }
-            
-            break;
-        }
-        case TEXT_BANK_FILECHOOSE: {
-            auto value = fileChooseMap[key].get<std::string>();
+static TextBankTemplates textBanks[TEXT_BANK_COUNT];
 
-            std::string searchString = "$0";
-            size_t index = value.find(searchString);
+// MARK: - Helpers
 
-            if (index != std::string::npos) {
-                assert(arg != nullptr);
-                value.replace(index, searchString.size(), std::string(arg));
-                return value;
-            } else {
-                return value;
-            }
+std::string GetParameritizedText(std::string_view key, TextBank bank, const char* arg) {
+    const TextBankTemplates& templates = textBanks[bank];
+    auto it = templates.find(key);
+    if (it == templates.end()) {
+        return "";
+    }
 
-            break;
-        }
+    const TextTemplate& entry = it->second;
+    // Scene names are used as-is
+    if (bank == TEXT_BANK_SCENES || entry.argPos == std::string::npos) {
+        return entry.text;
     }
+
+    assert(arg != nullptr);
+    static const size_t placeholderSize = 2; // "$0"
+    size_t argSize = strlen(arg);
+    std::string value;
+    value.reserve(entry.text.size() - placeholderSize + argSize);
+    value.append(entry.text, 0, entry.argPos);
+    value.append(arg, argSize);
+    value.append(entry.text, entry.argPos + placeholderSize, std::string::npos);
+    return value;
 }
 
 const char* GetLanguageCode() {
@@ -1026,6 +1010,27 @@ void RegisterOnDialogMessageHook() {
 
 // MARK: - Main Registration
 
+static void CompileTextBank(TextBank bank, const std::string& path) {
+    TextBankTemplates& templates = textBanks[bank];
+    templates.clear();
+
+    auto file = LUS::Context::GetInstance()->GetResourceManager()->LoadFile(path);
+    if (file == nullptr) {
+        return;
+    }
+
+    nlohmann::json bankJson = nlohmann::json::parse(file->Buffer, nullptr, true, true);
+    templates.reserve(bankJson.size());
+    for (auto& [key, value] : bankJson.items()) {
+        if (!value.is_string()) {
+            continue;
+        }
+        std::string text = value.get<std::string>();
+        size_t argPos = text.find("$0");
+        templates.emplace(key, TextTemplate{ std::move(text), argPos });
+    }
+}
+
 void InitTTSBank() {
     std::string languageSuffix = "_eng.json";
     switch (CVarGetInteger("gLanguages", 0)) {
@@ -1037,25 +1042,10 @@ void InitTTSBank() {
             break;
     }
 
-    auto sceneFile = LUS::Context::GetInstance()->GetResourceManager()->LoadFile("accessibility/texts/scenes" + languageSuffix);
-    if (sceneFile != nullptr) {
-        sceneMap = nlohmann::json::parse(sceneFile->Buffer, nullptr, true, true);
-    }
-    
-    auto miscFile = LUS::Context::GetInstance()->GetResourceManager()->LoadFile("accessibility/texts/misc" + languageSuffix);
-    if (miscFile != nullptr) {
-        miscMap = nlohmann::json::parse(miscFile->Buffer, nullptr, true, true);
-    }
-    
-    auto kaleidoFile = LUS::Context::GetInstance()->GetResourceManager()->LoadFile("accessibility/texts/kaleidoscope" + languageSuffix);
-    if (kaleidoFile != nullptr) {
-        kaleidoMap = nlohmann::json::parse(kaleidoFile->Buffer, nullptr, true, true);
-    }
-    
-    auto fileChooseFile = LUS::Context::GetInstance()->GetResourceManager()->LoadFile("accessibility/texts/filechoose" + languageSuffix);
-    if (fileChooseFile != nullptr) {
-        fileChooseMap = nlohmann::json::parse(fileChooseFile->Buffer, nullptr, true, true);
-    }
+    CompileTextBank(TEXT_BANK_SCENES, "accessibility/texts/scenes" + languageSuffix);
+    CompileTextBank(TEXT_BANK_MISC, "accessibility/texts/misc" + languageSuffix);
+    CompileTextBank(TEXT_BANK_KALEIDO, "accessibility/texts/kaleidoscope" + languageSuffix);
+    CompileTextBank(TEXT_BANK_FILECHOOSE, "accessibility/texts/filechoose" + languageSuffix);
 }
 
 void RegisterOnSetGameLanguageHook() {
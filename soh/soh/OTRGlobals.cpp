@@ -5,6 +5,7 @@
 #include <filesystem>
 #include <fstream>
 #include <chrono>
+#include <atomic>
 
 #include <ResourceManager.h>
 #include <File.h>
@@ -37,6 +38,7 @@
 #include "Enhancements/enhancementTypes.h"
 #include "Enhancements/debugconsole.h"
 #include "Enhancements/randomizer/randomizer.h"
+#include "Enhancements/headless/HeadlessMode.h"
 #include "Enhancements/randomizer/randomizer_entrance_tracker.h"
 #include "Enhancements/randomizer/randomizer_item_tracker.h"
 #include "Enhancements/randomizer/randomizer_check_tracker.h"
@@ -485,8 +487,12 @@ void OTRAudio_Thread() {
         #define AUDIO_FRAMES_PER_UPDATE (R_UPDATE_RATE > 0 ? R_UPDATE_RATE : 1 )
         #define NUM_AUDIO_CHANNELS 2
 
-        int samples_left = AudioPlayer_Buffered();
-        u32 num_audio_samples = samples_left < AudioPlayer_GetDesiredBuffered() ? SAMPLES_HIGH : SAMPLES_LOW;
+        // Headless mode has no audio backend draining the buffer, so keep the sample count fixed to stay deterministic
+        bool headless = HeadlessMode_IsHeadless();
+        u32 num_audio_samples = SAMPLES_LOW;
+        if (!headless && AudioPlayer_Buffered() < AudioPlayer_GetDesiredBuffered()) {
+            num_audio_samples = SAMPLES_HIGH;
+        }
 
         // 3 is the maximum authentic frame divisor.
         s16 audio_buffer[SAMPLES_HIGH * NUM_AUDIO_CHANNELS * 3];
@@ -494,7 +500,9 @@ void OTRAudio_Thread() {
             AudioMgr_CreateNextAudioBuffer(audio_buffer + i * (num_audio_samples * NUM_AUDIO_CHANNELS), num_audio_samples);
         }
 
-        AudioPlayer_Play((u8*)audio_buffer, num_audio_samples * (sizeof(int16_t) * NUM_AUDIO_CHANNELS * AUDIO_FRAMES_PER_UPDATE));
+        if (!headless) {
+            AudioPlayer_Play((u8*)audio_buffer, num_audio_samples * (sizeof(int16_t) * NUM_AUDIO_CHANNELS * AUDIO_FRAMES_PER_UPDATE));
+        }
 
         audio.processing = false;
         audio.cv_from_thread.notify_one();
@@ -1096,6 +1104,9 @@ extern "C" void InitOTR() {
 #elif defined(_WIN32)
     SpeechSynthesizer::Instance = new SAPISpeechSynthesizer();
     SpeechSynthesizer::Instance->Init();
+#else
+    SpeechSynthesizer::Instance = new NullSpeechSynthesizer();
+    SpeechSynthesizer::Instance->Init();
 #endif
     
     clearMtx = (uintptr_t)&gMtxClear;
@@ -1137,9 +1148,14 @@ extern "C" void SaveManager_ThreadPoolWait() {
     SaveManager::Instance->ThreadPoolWait();
 }
 
+extern "C" void OTRScene_PrefetchWait();
+
 extern "C" void DeinitOTR() {
     SaveManager_ThreadPoolWait();
+    OTRScene_PrefetchWait();
+    HeadlessMode_Shutdown();
     OTRAudio_Exit();
+    SpeechSynthesizer::Instance->Uninitialize();
 #ifdef ENABLE_CROWD_CONTROL
     CrowdControl::Instance->Disable();
     CrowdControl::Instance->Shutdown();
@@ -1192,6 +1208,14 @@ extern "C" uint64_t GetUnixTimestamp() {
 
 // C->C++ Bridge
 extern "C" void Graph_ProcessFrame(void (*run_one_game_iter)(void)) {
+    if (HeadlessMode_IsHeadless()) {
+        // Run unpaced until the frame limit or replay is done, then return to main so DeinitOTR runs
+        while (!HeadlessMode_ShouldStop()) {
+            run_one_game_iter();
+        }
+        return;
+    }
+
     OTRGlobals::Instance->context->GetWindow()->MainLoop(run_one_game_iter);
 }
 
@@ -1294,13 +1318,7 @@ void RunCommands(Gfx* Commands, const std::vector<std::unordered_map<Mtx*, MtxF>
 }
 
 // C->C++ Bridge
-extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
-    {
-        std::unique_lock<std::mutex> Lock(audio.mutex);
-        audio.processing = true;
-    }
-
-    audio.cv_to_thread.notify_one();
+static void Graph_RunGfxCommands(Gfx* commands) {
     std::vector<std::unordered_map<Mtx*, MtxF>> mtx_replacements;
     int target_fps = OTRGlobals::Instance->GetInterpolationFPS();
     static int last_fps;
@@ -1340,8 +1358,26 @@ extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
 
     last_fps = fps;
     last_update_rate = R_UPDATE_RATE;
+}
 
-    {
+extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
+    bool processAudio = HeadlessMode_IsAudioEnabled();
+
+    if (processAudio) {
+        {
+            std::unique_lock<std::mutex> Lock(audio.mutex);
+            audio.processing = true;
+        }
+
+        audio.cv_to_thread.notify_one();
+    }
+
+    // Headless mode only advances game logic, the display list built this frame is discarded
+    if (!HeadlessMode_IsHeadless()) {
+        Graph_RunGfxCommands(commands);
+    }
+
+    if (processAudio) {
         std::unique_lock<std::mutex> Lock(audio.mutex);
         while (audio.processing) {
             audio.cv_from_thread.wait(Lock);
@@ -1354,6 +1390,7 @@ extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
         // Actually update the CVar now before runing the alt asset update listeners
         CVarSetInteger("gAltAssets", !CVarGetInteger("gAltAssets", 0));
         gfx_texture_cache_clear();
+        ResourceMgr_InvalidateHandles();
         LUS::SkeletonPatcher::UpdateSkeletons();
         GameInteractor::Instance->ExecuteHooks<GameInteractor::OnAssetAltChange>();
     }
@@ -1374,6 +1411,83 @@ extern "C" uint16_t OTRGetPixelDepth(float x, float y) {
     return OTRGlobals::Instance->context->GetWindow()->GetPixelDepth(x, y);
 }
 
+// Depth queries are collected for the whole frame and read back together, so the renderer only has to resolve the
+// depth buffer once no matter how many glowing lights are on screen.
+static std::vector<std::pair<float, float>> sDepthQueries;
+static std::vector<uint16_t> sDepthQueryResults;
+
+// Headless mode has no rendered depth buffer. Queries there sample this CPU-side buffer instead, which a harness can
+// fill with OTRDepthQuery_SetSoftwareDepth to put occluders in front of lights. Without one every sample is the far
+// plane.
+static std::vector<uint16_t> sSoftwareDepth;
+static int32_t sSoftwareDepthWidth;
+static int32_t sSoftwareDepthHeight;
+
+extern "C" void OTRDepthQuery_SetSoftwareDepth(const uint16_t* depth, int32_t width, int32_t height) {
+    if (depth == nullptr || width <= 0 || height <= 0) {
+        sSoftwareDepth.clear();
+        sSoftwareDepthWidth = sSoftwareDepthHeight = 0;
+        return;
+    }
+
+    sSoftwareDepth.assign(depth, depth + (size_t)width * height);
+    sSoftwareDepthWidth = width;
+    sSoftwareDepthHeight = height;
+}
+
+static uint16_t OTRDepthQuery_SampleSoftwareDepth(float x, float y) {
+    if (sSoftwareDepth.empty()) {
+        return UINT16_MAX;
+    }
+
+    int32_t px = std::clamp((int32_t)x, 0, sSoftwareDepthWidth - 1);
+    int32_t py = std::clamp((int32_t)y, 0, sSoftwareDepthHeight - 1);
+    return sSoftwareDepth[(size_t)py * sSoftwareDepthWidth + px];
+}
+
+extern "C" void OTRDepthQuery_Begin() {
+    sDepthQueries.clear();
+    sDepthQueryResults.clear();
+}
+
+extern "C" int32_t OTRDepthQuery_Add(float x, float y) {
+    for (size_t i = 0; i < sDepthQueries.size(); i++) {
+        if (sDepthQueries[i].first == x && sDepthQueries[i].second == y) {
+            return i;
+        }
+    }
+
+    sDepthQueries.emplace_back(x, y);
+    return sDepthQueries.size() - 1;
+}
+
+extern "C" void OTRDepthQuery_Resolve() {
+    sDepthQueryResults.resize(sDepthQueries.size());
+
+    if (HeadlessMode_IsHeadless()) {
+        for (size_t i = 0; i < sDepthQueries.size(); i++) {
+            sDepthQueryResults[i] = OTRDepthQuery_SampleSoftwareDepth(sDepthQueries[i].first, sDepthQueries[i].second);
+        }
+        return;
+    }
+
+    auto window = OTRGlobals::Instance->context->GetWindow();
+    for (auto& [x, y] : sDepthQueries) {
+        window->GetPixelDepthPrepare(x, y);
+    }
+    for (size_t i = 0; i < sDepthQueries.size(); i++) {
+        sDepthQueryResults[i] = window->GetPixelDepth(sDepthQueries[i].first, sDepthQueries[i].second);
+    }
+}
+
+extern "C" uint16_t OTRDepthQuery_Get(int32_t query) {
+    if (query < 0 || (size_t)query >= sDepthQueryResults.size()) {
+        return UINT16_MAX;
+    }
+
+    return sDepthQueryResults[query];
+}
+
 extern "C" uint32_t ResourceMgr_GetNumGameVersions() {
     return LUS::Context::GetInstance()->GetResourceManager()->GetArchive()->GetGameVersions().size();
 }
@@ -1674,6 +1788,54 @@ extern "C" Gfx* ResourceMgr_LoadGfxByName(const char* path)
     return (Gfx*)&res->Instructions[0];
 }
 
+// Read from the audio thread as well, so the generation is atomic
+static std::atomic<uint32_t> sResourceHandleGeneration = 1;
+// Handles hold a reference to the resource they resolved so the cached pointer stays valid until invalidation. Keyed
+// by handle so re-resolving after a Master Quest change replaces the previous reference instead of adding another.
+static std::unordered_map<ResourceHandle*, std::shared_ptr<LUS::IResource>> sResourceHandleRefs;
+
+extern "C" void ResourceMgr_InvalidateHandles() {
+    sResourceHandleGeneration++;
+    sResourceHandleRefs.clear();
+}
+
+extern "C" uint32_t ResourceMgr_GetHandleGeneration() {
+    return sResourceHandleGeneration;
+}
+
+static bool ResourceMgr_HandleIsResolved(ResourceHandle* handle) {
+    return handle->generation == sResourceHandleGeneration &&
+           (!handle->hasMQVariant || handle->isMQ == IsGameMasterQuest());
+}
+
+static void ResourceMgr_ResolveHandle(ResourceHandle* handle, std::shared_ptr<LUS::IResource> res, void* data) {
+    handle->data = data;
+    handle->generation = sResourceHandleGeneration;
+    handle->hasMQVariant = strstr(handle->path, "/nonmq/") != nullptr;
+    handle->isMQ = handle->hasMQVariant && IsGameMasterQuest();
+    sResourceHandleRefs[handle] = res;
+}
+
+extern "C" Gfx* ResourceMgr_LoadGfxByHandle(ResourceHandle* handle) {
+    if (!ResourceMgr_HandleIsResolved(handle)) {
+        ResourceMgr_UnloadOriginalWhenAltExists(handle->path);
+
+        auto res = std::static_pointer_cast<LUS::DisplayList>(GetResourceByNameHandlingMQ(handle->path));
+        ResourceMgr_ResolveHandle(handle, res, &res->Instructions[0]);
+    }
+
+    return (Gfx*)handle->data;
+}
+
+extern "C" Vtx* ResourceMgr_LoadVtxByHandle(ResourceHandle* handle) {
+    if (!ResourceMgr_HandleIsResolved(handle)) {
+        auto res = LUS::Context::GetInstance()->GetResourceManager()->LoadResource(handle->path);
+        ResourceMgr_ResolveHandle(handle, res, res != nullptr ? res->GetRawPointer() : nullptr);
+    }
+
+    return (Vtx*)handle->data;
+}
+
 extern "C" uint8_t ResourceMgr_FileIsCustomByName(const char* path) {
     auto res = std::static_pointer_cast<LUS::DisplayList>(GetResourceByNameHandlingMQ(path));
     return res->GetInitData()->IsCustom;
@@ -1761,6 +1923,53 @@ extern "C" void ResourceMgr_UnpatchGfxByName(const char* path, const char* patch
     }
 }
 
+static void ResourceMgr_ResolveGfxPatchSite(GfxPatchSite* site, const char* path, int index) {
+    auto res = std::static_pointer_cast<LUS::DisplayList>(
+        LUS::Context::GetInstance()->GetResourceManager()->LoadResource(path));
+
+    // Still the same resource, so the recorded original and patch state carry over
+    if (res == site->resource) {
+        site->generation = sResourceHandleGeneration;
+        return;
+    }
+
+    site->resource = res;
+    site->generation = sResourceHandleGeneration;
+    site->patched = false;
+
+    // Do not patch custom assets as they most likely do not have the same instructions as authentic assets
+    site->gfx = res->GetInitData()->IsCustom ? nullptr : (Gfx*)&res->Instructions[index];
+}
+
+void ResourceMgr_PatchGfxSite(GfxPatchSite* site, const char* path, int index, Gfx instruction) {
+    if (site->generation != sResourceHandleGeneration) {
+        ResourceMgr_ResolveGfxPatchSite(site, path, index);
+    }
+
+    if (site->gfx == nullptr) {
+        return;
+    }
+
+    if (!site->patched) {
+        site->original = *site->gfx;
+        site->patched = true;
+    }
+
+    if (site->gfx->words.w0 != instruction.words.w0 || site->gfx->words.w1 != instruction.words.w1) {
+        *site->gfx = instruction;
+    }
+}
+
+void ResourceMgr_UnpatchGfxSite(GfxPatchSite* site) {
+    if (!site->patched) {
+        return;
+    }
+
+    // The site holds a reference to the resource it patched, so this is safe even after the handle cache was invalidated
+    *site->gfx = site->original;
+    site->patched = false;
+}
+
 extern "C" char* ResourceMgr_LoadArrayByName(const char* path)
 {
     auto res = std::static_pointer_cast<LUS::Array>(GetResourceByNameHandlingMQ(path));
@@ -1870,6 +2079,33 @@ extern "C" SoundFont* ResourceMgr_LoadAudioSoundFont(const char* path) {
     return (SoundFont*) ResourceGetDataByName(path);
 }
 
+// Counters for the audio host lookup in audio_load.c. They are bumped on the audio thread and read from the audio
+// editor, so they live here rather than in the C side.
+static std::atomic<uint32_t> sAudioHostCacheHits = 0;
+static std::atomic<uint32_t> sAudioHostCacheMisses = 0;
+static std::atomic<uint32_t> sAudioHostCacheEntries = 0;
+
+extern "C" void AudioHostCache_RecordHit() {
+    sAudioHostCacheHits++;
+}
+
+extern "C" void AudioHostCache_RecordMiss(uint8_t resolved) {
+    sAudioHostCacheMisses++;
+    if (resolved) {
+        sAudioHostCacheEntries++;
+    }
+}
+
+extern "C" void AudioHostCache_ClearEntries() {
+    sAudioHostCacheEntries = 0;
+}
+
+extern "C" void AudioLoad_GetHostCacheStats(AudioHostCacheStats* stats) {
+    stats->hits = sAudioHostCacheHits;
+    stats->misses = sAudioHostCacheMisses;
+    stats->numEntries = sAudioHostCacheEntries;
+}
+
 extern "C" int ResourceMgr_OTRSigCheck(char* imgData)
 {
 	uintptr_t i = (uintptr_t)(imgData);
@@ -15,6 +15,20 @@
 #define BTN_MODIFIER1 0x00040
 #define BTN_MODIFIER2 0x00080
 
+// A by-name resource lookup that is resolved once and then served from the cached pointer until the handle
+// cache is invalidated (alt asset toggle, alt asset unload in GameState_Destroy) or the Master Quest state of the
+// current scene changes.
+// Declare handles as statics with RESOURCE_HANDLE so the path string is interned alongside the result.
+typedef struct {
+    const char* path;
+    void* data;
+    uint32_t generation;
+    uint8_t isMQ;
+    uint8_t hasMQVariant;
+} ResourceHandle;
+
+#define RESOURCE_HANDLE(resPath) { resPath, NULL, 0, 0, 0 }
+
 #ifdef __cplusplus
 #include <Context.h>
 #include "Enhancements/savestates.h"
@@ -63,6 +77,19 @@ private:
 };
 
 uint32_t IsGameMasterQuest();
+
+// A display list patch bound to a single call site. The target instruction is resolved on first use and kept until
+// the handle cache is invalidated, so reapplying the patch every frame is a compare and a store.
+struct GfxPatchSite {
+    std::shared_ptr<LUS::IResource> resource;
+    Gfx* gfx = nullptr;
+    Gfx original;
+    uint32_t generation = 0;
+    bool patched = false;
+};
+
+void ResourceMgr_PatchGfxSite(GfxPatchSite* site, const char* path, int index, Gfx instruction);
+void ResourceMgr_UnpatchGfxSite(GfxPatchSite* site);
 #endif
 
 #ifndef __cplusplus
@@ -79,6 +106,11 @@ void OTRLogString(const char* src);
 void OTRGfxPrint(const char* str, void* printer, void (*printImpl)(void*, char));
 void OTRGetPixelDepthPrepare(float x, float y);
 uint16_t OTRGetPixelDepth(float x, float y);
+void OTRDepthQuery_Begin();
+int32_t OTRDepthQuery_Add(float x, float y);
+void OTRDepthQuery_Resolve();
+uint16_t OTRDepthQuery_Get(int32_t query);
+void OTRDepthQuery_SetSoftwareDepth(const uint16_t* depth, int32_t width, int32_t height);
 int32_t OTRGetLastScancode();
 uint32_t ResourceMgr_IsGameMasterQuest();
 uint32_t ResourceMgr_IsSceneMasterQuest(s16 sceneNum);
@@ -108,6 +140,10 @@ AnimationHeaderCommon* ResourceMgr_LoadAnimByName(const char* path);
 char* ResourceMgr_GetNameByCRC(uint64_t crc, char* alloc);
 Gfx* ResourceMgr_LoadGfxByCRC(uint64_t crc);
 Gfx* ResourceMgr_LoadGfxByName(const char* path);
+Gfx* ResourceMgr_LoadGfxByHandle(ResourceHandle* handle);
+Vtx* ResourceMgr_LoadVtxByHandle(ResourceHandle* handle);
+void ResourceMgr_InvalidateHandles();
+uint32_t ResourceMgr_GetHandleGeneration();
 uint8_t ResourceMgr_FileIsCustomByName(const char* path);
 void ResourceMgr_PatchGfxByName(const char* path, const char* patchName, int index, Gfx instruction);
 void ResourceMgr_UnpatchGfxByName(const char* path, const char* patchName);
@@ -118,10 +154,14 @@ Vtx* ResourceMgr_LoadVtxByName(char* path);
 SoundFont* ResourceMgr_LoadAudioSoundFont(const char* path);
 SequenceData ResourceMgr_LoadSeqByName(const char* path);
 SoundFontSample* ResourceMgr_LoadAudioSample(const char* path);
+void AudioHostCache_RecordHit();
+void AudioHostCache_RecordMiss(uint8_t resolved);
+void AudioHostCache_ClearEntries();
 CollisionHeader* ResourceMgr_LoadColByName(const char* path);
 void Ctx_ReadSaveFile(uintptr_t addr, void* dramAddr, size_t size);
 void Ctx_WriteSaveFile(uintptr_t addr, void* dramAddr, size_t size);
 
+uint64_t GetFrequency();
 uint64_t GetPerfCounter();
 struct SkeletonHeader* ResourceMgr_LoadSkeletonByName(const char* path, SkelAnime* skelAnime);
 void ResourceMgr_UnregisterSkeleton(SkelAnime* skelAnime);
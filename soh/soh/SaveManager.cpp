@@ -905,13 +905,35 @@ int copy_file(const char* src, const char* dst) {
 }
 #endif
 
-// Threaded SaveFile takes copy of gSaveContext for local unmodified storage
+// Threaded SaveFile writes the oldest pending snapshot of gSaveContext for the file, covering every section folded into
+// it. The pending snapshot is taken while holding the file lock, so a newer snapshot is always written after an older
+// one and never overwritten by it.
+
+void SaveManager::SaveFileThreaded(int fileNum) {
+    SaveContext* saveContext;
+    std::set<int> sectionIDs;
+
+    std::lock_guard<std::mutex> fileLock(saveFileMutex);
+    {
+        std::lock_guard<std::mutex> lock(pendingSavesMutex);
+        auto pending = pendingSaves.find(fileNum);
+        // Already written by a synchronous save that took over this one
+        if (pending == pendingSaves.end()) {
+            return;
+        }
+        saveContext = pending->second.front().saveContext;
+        sectionIDs = std::move(pending->second.front().sectionIDs);
+        pending->second.pop_front();
+        if (pending->second.empty()) {
+            pendingSaves.erase(pending);
+        }
+    }
 
-void SaveManager::SaveFileThreaded(int fileNum, SaveContext* saveContext, int sectionID) {
     SPDLOG_INFO("Save File - fileNum: {}", fileNum);
     // Needed for first time save, hasn't changed in forever anyway
     saveBlock["version"] = 1;
-    if (sectionID == SECTION_ID_BASE) {
+    bool saveBase = sectionIDs.contains(SECTION_ID_BASE);
+    if (saveBase) {
         for (auto& sectionHandlerPair : sectionSaveHandlers) {
             auto& saveFuncInfo = sectionHandlerPair.second;
             // Don't call SaveFuncs for sections that aren't tied to game save
@@ -928,10 +950,18 @@ void SaveManager::SaveFileThreaded(int fileNum, SaveContext* saveContext, int se
             }
 
             currentJsonContext = &sectionBlock["data"];
-            sectionHandlerPair.second.func(saveContext, sectionID, true);
+            sectionHandlerPair.second.func(saveContext, SECTION_ID_BASE, true);
+        }
+    }
+    for (int sectionID : sectionIDs) {
+        if (sectionID == SECTION_ID_BASE) {
+            continue;
         }
-    } else {
         SaveFuncInfo svi = sectionSaveHandlers.find(sectionID)->second;
+        // Already written in full by the base save above
+        if (saveBase && svi.saveWithBase) {
+            continue;
+        }
         auto& sectionName = svi.name;
         auto sectionVersion = svi.version;
         // If section has a parentSection, it is a subsection. Load parentSection version and set sectionBlock to parent string
@@ -953,14 +983,14 @@ void SaveManager::SaveFileThreaded(int fileNum, SaveContext* saveContext, int se
         std::filesystem::remove(tempFile);
     }
 
+    std::string json_string = saveBlock.dump(4);
 #if defined(__SWITCH__) || defined(__WIIU__)
     FILE* w = fopen(tempFile.c_str(), "w");
-    std::string json_string = saveBlock.dump(4);
     fwrite(json_string.c_str(), sizeof(char), json_string.length(), w);
     fclose(w);
 #else
     std::ofstream output(tempFile);
-    output << std::setw(4) << saveBlock << std::endl;
+    output << json_string << std::endl;
     output.close();
 #endif
 
@@ -981,10 +1011,23 @@ void SaveManager::SaveFileThreaded(int fileNum, SaveContext* saveContext, int se
     delete saveContext;
     InitMeta(fileNum);
     GameInteractor::Instance->ExecuteHooks<GameInteractor::OnSaveFile>(fileNum);
-    SPDLOG_INFO("Save File Finish - fileNum: {}", fileNum);
+
+    {
+        std::lock_guard<std::mutex> lock(pendingSavesMutex);
+        saveStats.writtenSaves++;
+        saveStats.bytesWritten += json_string.length();
+    }
+    SaveStats stats = GetSaveStats();
+    SPDLOG_INFO("Save File Finish - fileNum: {} ({} sections, {} bytes). {} saves requested, {} written ({} bytes), "
+                "{} still queued",
+                fileNum, sectionIDs.size(), json_string.length(), stats.requestedSaves, stats.writtenSaves,
+                stats.bytesWritten, stats.pendingFiles);
 }
 
-// SaveSection creates a copy of gSaveContext to prevent mid-save data modification, and passes its reference to SaveFileThreaded
+// SaveSection copies gSaveContext to prevent mid-save data modification and queues it for SaveFileThreaded. If a save
+// for the file is already queued, its copy is refreshed and the section added to it instead of queueing another write.
+// A queued base save is left alone: its snapshot can hold state that is only valid at that point, such as the real B
+// button restored by Play_PerformSave, so anything requested after it is queued as its own write.
 // This should never be called with threaded == false except during file creation
 void SaveManager::SaveSection(int fileNum, int sectionID, bool threaded) {
     // Don't save in Boss rush.
@@ -996,12 +1039,28 @@ void SaveManager::SaveSection(int fileNum, int sectionID, bool threaded) {
         SPDLOG_ERROR("SaveSection: Section ID not registered.");
         return;
     }
-    auto saveContext = new SaveContext;
-    memcpy(saveContext, &gSaveContext, sizeof(gSaveContext));
-    if (threaded) {
-        smThreadPool->push_task_back(&SaveManager::SaveFileThreaded, this, fileNum, saveContext, sectionID);
-    } else {
-        SaveFileThreaded(fileNum, saveContext, sectionID);
+    bool queueWrite;
+    size_t numQueued;
+    {
+        std::lock_guard<std::mutex> lock(pendingSavesMutex);
+        std::deque<PendingSave>& queued = pendingSaves[fileNum];
+        queueWrite = queued.empty() || queued.back().sectionIDs.contains(SECTION_ID_BASE);
+        if (queueWrite) {
+            queued.push_back(PendingSave{ new SaveContext, {} });
+        }
+        memcpy(queued.back().saveContext, &gSaveContext, sizeof(gSaveContext));
+        queued.back().sectionIDs.insert(sectionID);
+        numQueued = queued.size();
+        saveStats.requestedSaves++;
+    }
+
+    if (!threaded) {
+        // Writes immediately, taking over anything still queued for this file, oldest first
+        for (size_t i = 0; i < numQueued; i++) {
+            SaveFileThreaded(fileNum);
+        }
+    } else if (queueWrite) {
+        smThreadPool->push_task_back(&SaveManager::SaveFileThreaded, this, fileNum);
     }
 }
 
@@ -1078,6 +1137,13 @@ void SaveManager::ThreadPoolWait() {
     }
 }
 
+SaveManager::SaveStats SaveManager::GetSaveStats() {
+    std::lock_guard<std::mutex> lock(pendingSavesMutex);
+    SaveStats stats = saveStats;
+    stats.pendingFiles = pendingSaves.size();
+    return stats;
+}
+
 bool SaveManager::SaveFile_Exist(int fileNum) {
     try {
         bool exists = std::filesystem::exists(GetFileName(fileNum));
@@ -33,7 +33,10 @@ typedef struct {
 
 #ifdef __cplusplus
 
+#include <deque>
 #include <map>
+#include <mutex>
+#include <set>
 #include <string>
 #include <tuple>
 #include <functional>
@@ -65,6 +68,13 @@ class SaveManager {
         int parentSection;
     } SaveFuncInfo;
 
+    typedef struct {
+        size_t pendingFiles;      // Files with a save queued but not yet written
+        uint64_t requestedSaves;  // SaveSection calls
+        uint64_t writtenSaves;    // Files actually written to disk
+        uint64_t bytesWritten;
+    } SaveStats;
+
     SaveManager();
 
     void Init();
@@ -76,6 +86,7 @@ class SaveManager {
     void LoadFile(int fileNum);
     bool SaveFile_Exist(int fileNum);
     void ThreadPoolWait();
+    SaveStats GetSaveStats();
 
     // Adds a function that is called when we are intializing a save, including when we are loading a save.
     void AddInitFunction(InitFunc func);
@@ -148,7 +159,20 @@ class SaveManager {
     void ConvertFromUnversioned();
     void CreateDefaultGlobal();
 
-    void SaveFileThreaded(int fileNum, SaveContext* saveContext, int sectionID);
+    void SaveFileThreaded(int fileNum);
+
+    // A section save requested while an earlier one for the same file is still queued is folded into the newest queued
+    // write, its snapshot refreshed and the section added, unless that write includes the base section. Base snapshots
+    // are never overwritten, the later request gets its own write after it.
+    typedef struct {
+        SaveContext* saveContext;
+        std::set<int> sectionIDs;
+    } PendingSave;
+
+    std::mutex pendingSavesMutex;
+    std::map<int, std::deque<PendingSave>> pendingSaves;
+    std::mutex saveFileMutex;
+    SaveStats saveStats = {};
 
     void InitMeta(int slotNum);
     static void InitFileImpl(bool isDebug);
@@ -442,6 +442,11 @@ void DrawSettingsMenu() {
                 UIWidgets::Tooltip("Allows windows to be able to be dragged off of the main game window. Requires a reload to take effect.");
             }
 
+            UIWidgets::PaddedEnhancementCheckbox("Prefetch Adjacent Rooms", "gPrefetchRooms", true, false, false, "", UIWidgets::CheckboxGraphics::Cross, true);
+            UIWidgets::Tooltip("Loads rooms connected to the current room, and the next scene during a scene transition, in the background to reduce hitches when they are entered");
+            UIWidgets::PaddedEnhancementCheckbox("Skip Redundant Actor Lights", "gElideActorLights", true, false, false, "", UIWidgets::CheckboxGraphics::Cross, true);
+            UIWidgets::Tooltip("Reuses the previous actor's lights when the next actor is lit identically instead of sending them again");
+
             // If more filters are added to LUS, make sure to add them to the filters list here
             ImGui::Text("Texture Filter (Needs reload)");
 
@@ -1462,6 +1467,8 @@ void DrawDeveloperToolsMenu() {
         UIWidgets::Tooltip("Optimized debug warp screen, with the added ability to chose entrances and time of day");
         UIWidgets::PaddedEnhancementCheckbox("Debug Warp Screen Translation", "gDebugWarpScreenTranslation", true, false, false, "", UIWidgets::CheckboxGraphics::Cross, true);
         UIWidgets::Tooltip("Translate the Debug Warp Screen based on the game language");
+        UIWidgets::PaddedEnhancementCheckbox("Log Input Latency", "gInputLatencyLog", true, false);
+        UIWidgets::Tooltip("Periodically logs the time between reading the controllers and submitting the frame built from that input to the renderer");
         UIWidgets::PaddedSeparator();
         ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(12.0f, 6.0f));
         ImGui::PushStyleVar(ImGuiStyleVar_ButtonTextAlign, ImVec2(0,0));
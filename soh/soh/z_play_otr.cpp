@@ -11,6 +11,7 @@ extern "C" void Play_InitScene(PlayState * play, s32 spawn);
 extern "C" void Play_InitEnvironment(PlayState * play, s16 skyboxId);
 void OTRPlay_InitScene(PlayState* play, s32 spawn);
 s32 OTRScene_ExecuteCommands(PlayState* play, LUS::Scene* scene);
+void OTRScene_ClearPrefetched();
 
 //LUS::OTRResource* OTRPlay_LoadFile(PlayState* play, RomFile* file) {
 LUS::IResource* OTRPlay_LoadFile(PlayState* play, const char* fileName)
@@ -19,6 +20,20 @@ LUS::IResource* OTRPlay_LoadFile(PlayState* play, const char* fileName)
     return res.get();
 }
 
+std::string OTRPlay_GetScenePath(s32 sceneNum, bool isMQ) {
+    SceneTableEntry* scene = &gSceneTable[sceneNum];
+
+    // Scenes considered "dungeon" with a MQ variant
+    int16_t inNonSharedScene = (sceneNum >= SCENE_DEKU_TREE && sceneNum <= SCENE_ICE_CAVERN) ||
+                               sceneNum == SCENE_GERUDO_TRAINING_GROUND || sceneNum == SCENE_INSIDE_GANONS_CASTLE;
+
+    std::string sceneVersion = "shared";
+    if (inNonSharedScene) {
+        sceneVersion = isMQ ? "mq" : "nonmq";
+    }
+    return StringHelper::Sprintf("scenes/%s/%s/%s", sceneVersion.c_str(), scene->sceneFile.fileName, scene->sceneFile.fileName);
+}
+
 extern "C" void OTRPlay_SpawnScene(PlayState* play, s32 sceneNum, s32 spawn) {
     SceneTableEntry* scene = &gSceneTable[sceneNum];
 
@@ -29,16 +44,9 @@ extern "C" void OTRPlay_SpawnScene(PlayState* play, s32 sceneNum, s32 spawn) {
 
     //osSyncPrintf("\nSCENE SIZE %fK\n", (scene->sceneFile.vromEnd - scene->sceneFile.vromStart) / 1024.0f);
 
-    // Scenes considered "dungeon" with a MQ variant
-    int16_t inNonSharedScene = (sceneNum >= SCENE_DEKU_TREE && sceneNum <= SCENE_ICE_CAVERN) ||
-                               sceneNum == SCENE_GERUDO_TRAINING_GROUND || sceneNum == SCENE_INSIDE_GANONS_CASTLE;
-
-    std::string sceneVersion = "shared";
-    if (inNonSharedScene) {
-        sceneVersion = IsGameMasterQuest() ? "mq" : "nonmq";
-    }
-    std::string scenePath = StringHelper::Sprintf("scenes/%s/%s/%s", sceneVersion.c_str(), scene->sceneFile.fileName, scene->sceneFile.fileName);
+    std::string scenePath = OTRPlay_GetScenePath(sceneNum, IsGameMasterQuest());
 
+    OTRScene_ClearPrefetched();
     play->sceneSegment = OTRPlay_LoadFile(play, scenePath.c_str());
 
     // Failed to load scene... default to doodongs cavern
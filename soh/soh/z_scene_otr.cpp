@@ -12,6 +12,9 @@
 #include <Blob.h>
 #include <memory>
 #include <cassert>
+#include <mutex>
+#include <unordered_set>
+#include "thread-pool/BS_thread_pool.hpp"
 #include "soh/resource/type/scenecommand/SetCameraSettings.h"
 #include "soh/resource/type/scenecommand/SetCutscenes.h"
 #include "soh/resource/type/scenecommand/SetStartPositionList.h"
@@ -38,6 +41,8 @@ extern LUS::IResource* OTRPlay_LoadFile(PlayState* play, const char* fileName);
 extern "C" s32 Object_Spawn(ObjectContext* objectCtx, s16 objectId);
 extern "C" RomFile sNaviMsgFiles[];
 s32 OTRScene_ExecuteCommands(PlayState* play, LUS::Scene* scene);
+std::string OTRPlay_GetScenePath(s32 sceneNum, bool isMQ);
+void OTRScene_PrefetchAdjacentRooms(PlayState* play, s32 roomNum);
 
 std::shared_ptr<LUS::File> ResourceMgr_LoadFile(const char* path) {
     std::string Path = path;
@@ -502,6 +507,7 @@ extern "C" s32 OTRfunc_800973FC(PlayState* play, RoomContext* roomCtx) {
             OTRScene_ExecuteCommands(play, (LUS::Scene*)roomCtx->roomToLoad);
             Player_SetBootData(play, GET_PLAYER(play));
             Actor_SpawnTransitionActors(play, &play->actorCtx);
+            OTRScene_PrefetchAdjacentRooms(play, roomCtx->curRoom.num);
 
             return 1;
         }
@@ -548,3 +554,170 @@ extern "C" s32 OTRfunc_8009728C(PlayState* play, RoomContext* roomCtx, s32 roomN
 
     return 0;
 }
+
+// Rooms reachable through a transition actor of the current room, and the spawn room of a pending scene change,
+// are loaded on a worker thread together with the object directories their object lists reference. The
+// synchronous loads in OTRfunc_8009728C and OTRPlay_SpawnScene are then normally resource cache hits.
+static std::shared_ptr<BS::thread_pool> sPrefetchPool;
+static std::mutex sPrefetchMutex;
+static std::unordered_set<std::string> sPrefetchedPaths;
+
+static bool OTRScene_MarkPrefetched(const std::string& path) {
+    std::lock_guard<std::mutex> lock(sPrefetchMutex);
+    return sPrefetchedPaths.insert(path).second;
+}
+
+static std::string OTRScene_HandleMQPath(const char* path, bool isMQ) {
+    std::string Path = path;
+    if (isMQ) {
+        size_t pos = 0;
+        if ((pos = Path.find("/nonmq/", 0)) != std::string::npos) {
+            Path.replace(pos, 7, "/mq/");
+        }
+    }
+    return Path;
+}
+
+static void OTRScene_PrefetchObjects(LUS::Scene* room) {
+    auto resourceMgr = LUS::Context::GetInstance()->GetResourceManager();
+
+    for (auto& cmd : room->commands) {
+        if (cmd == nullptr || cmd->cmdId != LUS::SceneCommandID::SetObjectList) {
+            continue;
+        }
+
+        auto cmdObj = std::static_pointer_cast<LUS::SetObjectList>(cmd);
+        for (int16_t objectId : cmdObj->objects) {
+            if (objectId <= OBJECT_INVALID || objectId >= OBJECT_ID_MAX) {
+                continue;
+            }
+
+            const char* objectName = gObjectTable[objectId].fileName;
+            if (objectName == nullptr || objectName[0] == '\0') {
+                continue;
+            }
+
+            std::string searchMask = StringHelper::Sprintf("objects/%s/*", objectName);
+            if (OTRScene_MarkPrefetched(searchMask)) {
+                resourceMgr->LoadDirectory(searchMask);
+            }
+        }
+    }
+}
+
+static void OTRScene_PrefetchRoomTask(std::string roomPath) {
+    auto room =
+        std::static_pointer_cast<LUS::Scene>(LUS::Context::GetInstance()->GetResourceManager()->LoadResource(roomPath));
+
+    if (room != nullptr) {
+        OTRScene_PrefetchObjects(room.get());
+    }
+}
+
+static void OTRScene_PrefetchSceneTask(std::string scenePath, s32 spawn, bool isMQ) {
+    auto scene =
+        std::static_pointer_cast<LUS::Scene>(LUS::Context::GetInstance()->GetResourceManager()->LoadResource(scenePath));
+
+    if (scene == nullptr) {
+        return;
+    }
+
+    std::shared_ptr<LUS::SetEntranceList> entranceList;
+    std::shared_ptr<LUS::SetRoomList> roomList;
+    for (auto& cmd : scene->commands) {
+        if (cmd == nullptr) {
+            continue;
+        }
+
+        if (cmd->cmdId == LUS::SceneCommandID::SetEntranceList) {
+            entranceList = std::static_pointer_cast<LUS::SetEntranceList>(cmd);
+        } else if (cmd->cmdId == LUS::SceneCommandID::SetRoomList) {
+            roomList = std::static_pointer_cast<LUS::SetRoomList>(cmd);
+        }
+    }
+
+    if (entranceList == nullptr || roomList == nullptr || (size_t)spawn >= entranceList->entrances.size()) {
+        return;
+    }
+
+    u8 roomNum = entranceList->entrances[spawn].room;
+    if (roomNum >= roomList->fileNames.size()) {
+        return;
+    }
+
+    std::string roomPath = OTRScene_HandleMQPath(roomList->fileNames[roomNum].c_str(), isMQ);
+    if (OTRScene_MarkPrefetched(roomPath)) {
+        OTRScene_PrefetchRoomTask(roomPath);
+    }
+}
+
+static bool OTRScene_PrefetchEnabled() {
+    if (!CVarGetInteger("gPrefetchRooms", 1)) {
+        return false;
+    }
+
+    if (sPrefetchPool == nullptr) {
+        sPrefetchPool = std::make_shared<BS::thread_pool>(1);
+    }
+
+    return true;
+}
+
+void OTRScene_PrefetchAdjacentRooms(PlayState* play, s32 roomNum) {
+    if (!OTRScene_PrefetchEnabled()) {
+        return;
+    }
+
+    bool isMQ = IsGameMasterQuest();
+
+    for (s32 i = 0; i < play->transiActorCtx.numActors; i++) {
+        TransitionActorEntry* entry = &play->transiActorCtx.list[i];
+        s8 nextRoom;
+
+        if (entry->sides[0].room == roomNum) {
+            nextRoom = entry->sides[1].room;
+        } else if (entry->sides[1].room == roomNum) {
+            nextRoom = entry->sides[0].room;
+        } else {
+            continue;
+        }
+
+        if (nextRoom < 0 || nextRoom >= play->numRooms || nextRoom == roomNum) {
+            continue;
+        }
+
+        std::string roomPath = OTRScene_HandleMQPath(play->roomList[nextRoom].fileName, isMQ);
+        if (OTRScene_MarkPrefetched(roomPath)) {
+            sPrefetchPool->push_task_back(OTRScene_PrefetchRoomTask, roomPath);
+        }
+    }
+}
+
+extern "C" void OTRScene_PrefetchEntrance(PlayState* play, s32 entranceIndex) {
+    if (entranceIndex < 0 || entranceIndex >= ENTR_MAX || !OTRScene_PrefetchEnabled()) {
+        return;
+    }
+
+    EntranceInfo* entrance = &gEntranceTable[entranceIndex];
+    if (entrance->scene < 0 || entrance->spawn < 0) {
+        return;
+    }
+
+    // The destination can differ from the current scene in MQ-ness when dungeons are mixed
+    bool isMQ = ResourceMgr_IsSceneMasterQuest(entrance->scene);
+    std::string scenePath = OTRPlay_GetScenePath(entrance->scene, isMQ);
+    if (OTRScene_MarkPrefetched(scenePath)) {
+        sPrefetchPool->push_task_back(OTRScene_PrefetchSceneTask, scenePath, entrance->spawn, isMQ);
+    }
+}
+
+void OTRScene_ClearPrefetched() {
+    std::lock_guard<std::mutex> lock(sPrefetchMutex);
+    sPrefetchedPaths.clear();
+}
+
+extern "C" void OTRScene_PrefetchWait() {
+    if (sPrefetchPool != nullptr) {
+        sPrefetchPool->wait_for_tasks();
+    }
+}
@@ -87,6 +87,80 @@ char* fontMap[256];
 uintptr_t fontStart;
 uint32_t fontOffsets[8192];
 
+// Host-side lookup of resolved sequences and soundfonts by id. The audio thread looks fonts up on every note and
+// sequences on every (re)load, which otherwise goes through a by-name resource lookup each time. Only the pointers
+// handed back by the resource manager are kept, the data itself stays owned by the resource manager, so the tables are
+// sized by id and never evict. They are dropped when resource handles are invalidated, and bypassed entirely when
+// gAudioHostCache is turned off in the audio editor. Hit/miss counters are kept in OTRGlobals.cpp.
+static SoundFont* sFontHostCache[256];
+static SequenceData* sSeqHostCache;
+static u8* sSeqHostCacheValid;
+static u32 sAudioHostCacheGeneration;
+
+static void AudioLoad_HostCacheValidate(void) {
+    u32 generation = ResourceMgr_GetHandleGeneration();
+
+    if (sAudioHostCacheGeneration != generation) {
+        sAudioHostCacheGeneration = generation;
+        memset(sFontHostCache, 0, sizeof(sFontHostCache));
+        if (sSeqHostCacheValid != NULL) {
+            memset(sSeqHostCacheValid, 0, sequenceMapSize);
+        }
+        AudioHostCache_ClearEntries();
+    }
+}
+
+SoundFont* AudioLoad_GetSoundFont(s32 fontId) {
+    SoundFont* sf;
+
+    if (fontId < 0 || fontId >= ARRAY_COUNT(fontMap)) {
+        return NULL;
+    }
+
+    if (!CVarGetInteger("gAudioHostCache", 1)) {
+        return ResourceMgr_LoadAudioSoundFont(fontMap[fontId]);
+    }
+
+    AudioLoad_HostCacheValidate();
+
+    if (sFontHostCache[fontId] != NULL) {
+        AudioHostCache_RecordHit();
+        return sFontHostCache[fontId];
+    }
+
+    sf = ResourceMgr_LoadAudioSoundFont(fontMap[fontId]);
+    if (sf != NULL) {
+        sFontHostCache[fontId] = sf;
+    }
+    AudioHostCache_RecordMiss(sf != NULL);
+    return sf;
+}
+
+SequenceData AudioLoad_GetSequenceData(s32 seqId) {
+    SequenceData empty;
+
+    if (seqId < 0 || (size_t)seqId >= sequenceMapSize) {
+        memset(&empty, 0, sizeof(empty));
+        return empty;
+    }
+
+    if (sSeqHostCacheValid == NULL || !CVarGetInteger("gAudioHostCache", 1)) {
+        return ResourceMgr_LoadSeqByName(sequenceMap[seqId]);
+    }
+
+    AudioLoad_HostCacheValidate();
+
+    if (sSeqHostCacheValid[seqId]) {
+        AudioHostCache_RecordHit();
+        return sSeqHostCache[seqId];
+    }
+
+    sSeqHostCache[seqId] = ResourceMgr_LoadSeqByName(sequenceMap[seqId]);
+    sSeqHostCacheValid[seqId] = true;
+    AudioHostCache_RecordMiss(true);
+    return sSeqHostCache[seqId];
+}
+
 void AudioLoad_DecreaseSampleDmaTtls(void) {
     u32 i;
 
@@ -585,7 +659,7 @@ s32 AudioLoad_SyncInitSeqPlayerInternal(s32 playerIdx, s32 seqId, s32 arg2) {
         authCachePolicy = seqCachePolicyMap[seqId];
         seqId = gAudioContext.seqToPlay[playerIdx];
     }
-    SequenceData seqData2 = ResourceMgr_LoadSeqByName(sequenceMap[seqId]);
+    SequenceData seqData2 = AudioLoad_GetSequenceData(seqId);
     if (authCachePolicy != -1) {
         seqData2.cachePolicy = authCachePolicy;
     }
@@ -706,7 +780,7 @@ SoundFontData* AudioLoad_SyncLoadFont(u32 fontId) {
         return NULL;
     }
 
-    SoundFont* sf = ResourceMgr_LoadAudioSoundFont(fontMap[fontId]);
+    SoundFont* sf = AudioLoad_GetSoundFont(fontId);
 
     sampleBankId1 = sf->sampleBankId1;
     sampleBankId2 = sf->sampleBankId2;
@@ -758,7 +832,7 @@ uintptr_t AudioLoad_SyncLoad(u32 tableType, u32 id, s32* didAllocate) {
 
         if (tableType == SEQUENCE_TABLE)
         {
-            SequenceData sData = ResourceMgr_LoadSeqByName(sequenceMap[id]);
+            SequenceData sData = AudioLoad_GetSequenceData(id);
             seqData = sData.seqData;
             size = sData.seqDataSize;
             medium = sData.medium;
@@ -767,7 +841,7 @@ uintptr_t AudioLoad_SyncLoad(u32 tableType, u32 id, s32* didAllocate) {
         }
         else if (tableType == FONT_TABLE)
         {
-            fnt = ResourceMgr_LoadAudioSoundFont(fontMap[id]);
+            fnt = AudioLoad_GetSoundFont(id);
             size = sizeof(SoundFont);
             medium = 2;
             cachePolicy = 0;
@@ -910,7 +984,7 @@ void AudioLoad_RelocateFont(s32 fontId, SoundFontData* mem, RelocInfo* relocInfo
     s32 numInstruments = 0;
     s32 numSfx = 0;
 
-    sf = ResourceMgr_LoadAudioSoundFont(fontMap[fontId]);
+    sf = AudioLoad_GetSoundFont(fontId);
     numDrums = sf->numDrums;
     numInstruments = sf->numInstruments;
     numSfx = sf->numSfx;
@@ -1351,6 +1425,8 @@ void AudioLoad_Init(void* heap, size_t heapSize) {
     char** customSeqList = ResourceMgr_ListFiles("custom/music/*", &customSeqListSize);
     sequenceMapSize = (size_t)(AudioCollection_SequenceMapSize() + customSeqListSize); 
     sequenceMap = malloc(sequenceMapSize * sizeof(char*));
+    sSeqHostCache = calloc(sequenceMapSize, sizeof(SequenceData));
+    sSeqHostCacheValid = calloc(sequenceMapSize, sizeof(u8));
     gAudioContext.seqLoadStatus = malloc(sequenceMapSize * sizeof(char*));
 
     for (size_t i = 0; i < seqListSize; i++)
@@ -1611,7 +1687,7 @@ s32 AudioLoad_SlowLoadSeq(s32 seqId, u8* ramAddr, s8* isDone) {
     slowLoad->sample.sampleAddr = NULL;
     slowLoad->isDone = isDone;
 
-    SequenceData sData = ResourceMgr_LoadSeqByName(sequenceMap[seqId]);
+    SequenceData sData = AudioLoad_GetSequenceData(seqId);
     char* seqData = sData.seqData;
     size = sData.seqDataSize;
     slowLoad->curDevAddr = seqData;
@@ -2079,7 +2155,7 @@ void AudioLoad_PreloadSamplesForFont(s32 fontId, s32 async, RelocInfo* relocInfo
 
     gAudioContext.numUsedSamples = 0;
 
-    SoundFont* sf = ResourceMgr_LoadAudioSoundFont(fontMap[fontId]);
+    SoundFont* sf = AudioLoad_GetSoundFont(fontId);
 
     numDrums = sf->numDrums;
     numInstruments = sf->numInstruments;
@@ -2209,7 +2285,7 @@ void AudioLoad_LoadPermanentSamples(void) {
             fontId = AudioLoad_GetRealTableIndex(FONT_TABLE, gAudioContext.permanentCache[i].id);
             //fontId = gAudioContext.permanentCache[i].id;
 
-            SoundFont* sf = ResourceMgr_LoadAudioSoundFont(fontMap[fontId]);
+            SoundFont* sf = AudioLoad_GetSoundFont(fontId);
             relocInfo.sampleBankId1 = sf->sampleBankId1;
             relocInfo.sampleBankId2 = sf->sampleBankId2;
 
@@ -335,9 +335,9 @@ Instrument* Audio_GetInstrumentInner(s32 fontId, s32 instId) {
     }
 
     int instCnt = 0;
-    SoundFont* sf = ResourceMgr_LoadAudioSoundFont(fontMap[fontId]);
+    SoundFont* sf = AudioLoad_GetSoundFont(fontId);
 
-    if (instId >= sf->numInstruments)
+    if (sf == NULL || instId >= sf->numInstruments)
         return NULL;
 
     inst = sf->instruments[instId];
@@ -363,8 +363,8 @@ Drum* Audio_GetDrum(s32 fontId, s32 drumId) {
     }
 
     
-    SoundFont* sf = ResourceMgr_LoadAudioSoundFont(fontMap[fontId]);
-    if (drumId < sf->numDrums) {
+    SoundFont* sf = AudioLoad_GetSoundFont(fontId);
+    if (sf != NULL && drumId < sf->numDrums) {
         drum = sf->drums[drumId];
     }
     
@@ -387,8 +387,8 @@ SoundFontSound* Audio_GetSfx(s32 fontId, s32 sfxId) {
         return NULL;
     }
 
-    SoundFont* sf = ResourceMgr_LoadAudioSoundFont(fontMap[fontId]);
-    if (sfxId < sf->numSfx) {
+    SoundFont* sf = AudioLoad_GetSoundFont(fontId);
+    if (sf != NULL && sfxId < sf->numSfx) {
         sfx = &sf->soundEffects[sfxId];
     }
 
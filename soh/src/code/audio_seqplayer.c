@@ -1070,7 +1070,7 @@ void AudioSeq_SequenceChannelProcessScript(SequenceChannel* channel) {
                                 gAudioContext.seqReplaced[seqPlayer->playerIdx] = 0;
                             }
                             u16 seqId = AudioEditor_GetReplacementSeq(seqPlayer->seqId);
-                            SequenceData sDat = ResourceMgr_LoadSeqByName(sequenceMap[seqId]);
+                            SequenceData sDat = AudioLoad_GetSequenceData(seqId);
                             command = sDat.fonts[sDat.numFonts - result - 1];
                         }
 
@@ -1187,7 +1187,7 @@ void AudioSeq_SequenceChannelProcessScript(SequenceChannel* channel) {
                                 gAudioContext.seqReplaced[seqPlayer->playerIdx] = 0;
                             }
                             u16 seqId = AudioEditor_GetReplacementSeq(seqPlayer->seqId);
-                            SequenceData sDat = ResourceMgr_LoadSeqByName(sequenceMap[seqId]);
+                            SequenceData sDat = AudioLoad_GetSequenceData(seqId);
 
                             // The game apparantely would sometimes do negative array lookups, the result of which would get rejected by AudioHeap_SearchCaches, never
                             // changing the actual fontid.
@@ -469,6 +469,7 @@ void GameState_Destroy(GameState* gameState) {
 
     if (CVarGetInteger("gAltAssets", 0)) {
         ResourceUnloadDirectory("alt/*");
+        ResourceMgr_InvalidateHandles();
         gfx_texture_cache_clear();
     }
 }
@@ -9,6 +9,7 @@
 #include "soh/Enhancements/debugger/colViewer.h"
 #include "soh/Enhancements/debugger/valueViewer.h"
 #include "soh/Enhancements/gameconsole.h"
+#include "soh/Enhancements/headless/HeadlessMode.h"
 #include "soh/OTRGlobals.h"
 
 #define GFXPOOL_HEAD_MAGIC 0x1234
@@ -518,7 +519,8 @@ static void RunFrame()
             //ticksB = GetPerfCounter();
 
             Graph_ProcessGfxCommands(runFrameContext.gfxCtx.workBuffer);
-
+            PadMgr_LogInputLatency();
+            HeadlessMode_EndFrame();
 
             //uint64_t diff = (ticksB - ticksA) / (freq / 1000);
             //printf("Frame simulated in %ims\n", diff);
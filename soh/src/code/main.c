@@ -64,6 +64,7 @@ int main(int argc, char** argv)
     // TODO: Was moved to below InitOTR because it requires window to be setup. But will be late to catch crashes.
     CrashHandlerRegisterCallback(CrashHandler_PrintSohData);
     BootCommands_Init();
+    BootCommands_ParseBootArgs(argc - 1, argv + 1);
 
     Heaps_Alloc();
     Main(0);
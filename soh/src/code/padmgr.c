@@ -3,9 +3,19 @@
 #include <string.h>
 
 #include "soh/Enhancements/game-interactor/GameInteractor.h"
+#include "soh/Enhancements/headless/HeadlessMode.h"
 
 s32 D_8012D280 = 1;
 
+// Input latency measurement, see PadMgr_LogInputLatency
+#define INPUT_LATENCY_REPORT_FRAMES 300
+
+static u64 sPadSampleTicks;
+static u64 sInputLatencyTotal;
+static u64 sInputLatencyMin;
+static u64 sInputLatencyMax;
+static u32 sInputLatencyFrames;
+
 void OTRControllerCallback(uint8_t rumble);
 
 OSMesgQueue* PadMgr_LockSerialMesgQueue(PadMgr* padMgr) {
@@ -316,6 +326,8 @@ void PadMgr_HandleRetraceMsg(PadMgr* padMgr) {
     }
     osRecvMesg(queue, NULL, OS_MESG_BLOCK);
     osContGetReadData(padMgr->pads);
+    sPadSampleTicks = GetPerfCounter();
+    HeadlessMode_ProcessPads(padMgr->pads);
 
     for (i = 0; i < __osMaxControllers; i++) {
         padMgr->padStatus[i].status = Controller_ShouldRumble(i);
@@ -467,3 +479,39 @@ void PadMgr_Init(PadMgr* padMgr, OSMesgQueue* siIntMsgQ, IrqMgr* irqMgr, OSId id
     osCreateThread(&padMgr->thread, id, (void (*)(void*))PadMgr_ThreadEntry, padMgr, stack, priority);
     osStartThread(&padMgr->thread);
 }
+
+/**
+ * Measures the time between sampling the controllers and handing the frame built from that input to the renderer.
+ * Called once per frame after the display list has been submitted. Enabled with gInputLatencyLog, reports the
+ * average, minimum and maximum every INPUT_LATENCY_REPORT_FRAMES frames.
+ */
+void PadMgr_LogInputLatency(void) {
+    u64 latency;
+    f64 ticksPerMs;
+
+    if (!CVarGetInteger("gInputLatencyLog", 0)) {
+        sInputLatencyFrames = 0;
+        return;
+    }
+
+    latency = GetPerfCounter() - sPadSampleTicks;
+
+    if (sInputLatencyFrames == 0) {
+        sInputLatencyTotal = 0;
+        sInputLatencyMin = latency;
+        sInputLatencyMax = latency;
+    }
+
+    sInputLatencyTotal += latency;
+    sInputLatencyMin = MIN(sInputLatencyMin, latency);
+    sInputLatencyMax = MAX(sInputLatencyMax, latency);
+    sInputLatencyFrames++;
+
+    if (sInputLatencyFrames >= INPUT_LATENCY_REPORT_FRAMES) {
+        ticksPerMs = GetFrequency() / 1000.0;
+        lusprintf(__FILE__, __LINE__, 2, "Input latency over %d frames: avg %.3fms, min %.3fms, max %.3fms",
+                  sInputLatencyFrames, sInputLatencyTotal / ticksPerMs / sInputLatencyFrames,
+                  sInputLatencyMin / ticksPerMs, sInputLatencyMax / ticksPerMs);
+        sInputLatencyFrames = 0;
+    }
+}
@@ -2647,19 +2647,48 @@ void Actor_FaultPrint(Actor* actor, char* command) {
     FaultDrawer_Printf("ACTOR NAME %08x:%s", actor, name);
 }
 
+ActorDrawStats gActorDrawStats;
+
+// The light set most recently drawn by Actor_Draw during the main actor draw pass. Actor draw functions never emit
+// their own lights, so when the next actor binds an identical set the RSP state already matches and the light
+// commands can be skipped. Only valid inside func_800315AC, since other code between draws may change the lights.
+static Lights* sActorDrawPrevLights = NULL;
+static s32 sActorDrawElideLights = false;
+
+static s32 Actor_LightsEqual(Lights* a, Lights* b) {
+    return (a->numLights == b->numLights) && !memcmp(&a->l.a, &b->l.a, sizeof(a->l.a)) &&
+           !memcmp(a->l.l, b->l.l, sizeof(a->l.l[0]) * a->numLights);
+}
+
 void Actor_Draw(PlayState* play, Actor* actor) {
     FaultClient faultClient;
     Lights* lights;
+    Lights boundLights;
 
     Fault_AddClient(&faultClient, Actor_FaultPrint, actor, "Actor_draw");
 
     FrameInterpolation_RecordOpenChild(actor, 0);
     OPEN_DISPS(play->state.gfxCtx);
 
-    lights = LightContext_NewLights(&play->lightCtx, play->state.gfxCtx);
+    // Cleared so padding bytes don't break the comparison with the previous set
+    memset(&boundLights, 0, sizeof(boundLights));
+    boundLights.l.a.l.col[0] = boundLights.l.a.l.colc[0] = play->lightCtx.ambientColor[0];
+    boundLights.l.a.l.col[1] = boundLights.l.a.l.colc[1] = play->lightCtx.ambientColor[1];
+    boundLights.l.a.l.col[2] = boundLights.l.a.l.colc[2] = play->lightCtx.ambientColor[2];
+    boundLights.numLights = 0;
 
-    Lights_BindAll(lights, play->lightCtx.listHead, (actor->flags & ACTOR_FLAG_IGNORE_POINTLIGHTS) ? NULL : &actor->world.pos);
-    Lights_Draw(lights, play->state.gfxCtx);
+    Lights_BindAll(&boundLights, play->lightCtx.listHead, (actor->flags & ACTOR_FLAG_IGNORE_POINTLIGHTS) ? NULL : &actor->world.pos);
+
+    if ((sActorDrawPrevLights != NULL) && Actor_LightsEqual(sActorDrawPrevLights, &boundLights)) {
+        lights = sActorDrawPrevLights;
+        gActorDrawStats.lightsElided++;
+        // gSPNumLights, one gSPLight per light and the ambient light, on both the opa and xlu buffers
+        gActorDrawStats.bytesSaved += 2 * (lights->numLights + 2) * sizeof(Gfx);
+    } else {
+        lights = Graph_Alloc(play->state.gfxCtx, sizeof(Lights));
+        *lights = boundLights;
+        Lights_Draw(lights, play->state.gfxCtx);
+    }
 
     FrameInterpolation_RecordActorPosRotMatrix();
     if (actor->flags & ACTOR_FLAG_IGNORE_QUAKE) {
@@ -2710,6 +2739,10 @@ void Actor_Draw(PlayState* play, Actor* actor) {
         actor->shape.shadowDraw(actor, lights, play);
     }
 
+    if (sActorDrawElideLights) {
+        sActorDrawPrevLights = lights;
+    }
+
     CLOSE_DISPS(play->state.gfxCtx);
     FrameInterpolation_RecordCloseChild();
 
@@ -2879,9 +2912,12 @@ void func_800315AC(PlayState* play, ActorContext* actorCtx) {
     s32 i;
 
     invisibleActorCounter = 0;
+    memset(&gActorDrawStats, 0, sizeof(gActorDrawStats));
 
     OPEN_DISPS(play->state.gfxCtx);
 
+    sActorDrawElideLights = CVarGetInteger("gElideActorLights", 1);
+    sActorDrawPrevLights = NULL;
     actorListEntry = &actorCtx->actorLists[0];
 
     for (i = 0; i < ARRAY_COUNT(actorCtx->actorLists); i++, actorListEntry++) {
@@ -2916,6 +2952,13 @@ void func_800315AC(PlayState* play, ActorContext* actorCtx) {
 
             actor->isDrawn = false;
 
+            if ((actor->init == NULL) && (actor->draw != NULL)) {
+                gActorDrawStats.considered++;
+                if (!(actor->flags & (ACTOR_FLAG_DRAW_WHILE_CULLED | ACTOR_FLAG_ACTIVE))) {
+                    gActorDrawStats.culled++;
+                }
+            }
+
             if ((HREG(64) != 1) || ((HREG(65) != -1) && (HREG(65) != HREG(66))) || (HREG(71) == 0)) {
                 if ((actor->init == NULL) && (actor->draw != NULL) && (actor->flags & (ACTOR_FLAG_DRAW_WHILE_CULLED | ACTOR_FLAG_ACTIVE))) {
                     if ((actor->flags & ACTOR_FLAG_LENS) &&
@@ -2928,6 +2971,7 @@ void func_800315AC(PlayState* play, ActorContext* actorCtx) {
                         if ((HREG(64) != 1) || ((HREG(65) != -1) && (HREG(65) != HREG(66))) || (HREG(72) == 0)) {
                             Actor_Draw(play, actor);
                             actor->isDrawn = true;
+                            gActorDrawStats.drawn++;
                         }
                     }
                 }
@@ -2937,6 +2981,9 @@ void func_800315AC(PlayState* play, ActorContext* actorCtx) {
         }
     }
 
+    sActorDrawElideLights = false;
+    sActorDrawPrevLights = NULL;
+
     if ((HREG(64) != 1) || (HREG(73) != 0)) {
         Effect_DrawAll(play->state.gfxCtx);
     }
@@ -3055,6 +3102,47 @@ void func_80031C3C(ActorContext* actorCtx, PlayState* play) {
     func_80030488(play);
 }
 
+/**
+ * The id index mirrors the category lists: actors are prepended whenever they are added to a category, so walking
+ * an id's list and skipping other categories visits actors in the same order as walking the category list.
+ */
+static void Actor_AddToIdIndex(ActorContext* actorCtx, Actor* actor) {
+    Actor* prevHead;
+
+    if (actor->id < 0 || actor->id >= ACTOR_ID_MAX) {
+        return;
+    }
+
+    prevHead = actorCtx->actorIdIndex[actor->id];
+
+    if (prevHead != NULL) {
+        prevHead->prevById = actor;
+    }
+
+    actorCtx->actorIdIndex[actor->id] = actor;
+    actor->prevById = NULL;
+    actor->nextById = prevHead;
+}
+
+static void Actor_RemoveFromIdIndex(ActorContext* actorCtx, Actor* actor) {
+    if (actor->id < 0 || actor->id >= ACTOR_ID_MAX) {
+        return;
+    }
+
+    if (actor->prevById != NULL) {
+        actor->prevById->nextById = actor->nextById;
+    } else {
+        actorCtx->actorIdIndex[actor->id] = actor->nextById;
+    }
+
+    if (actor->nextById != NULL) {
+        actor->nextById->prevById = actor->prevById;
+    }
+
+    actor->prevById = NULL;
+    actor->nextById = NULL;
+}
+
 /**
  * Adds a given actor instance at the front of the actor list of the specified category.
  * Also sets the actor instance as being of that category.
@@ -3063,6 +3151,7 @@ void Actor_AddToCategory(ActorContext* actorCtx, Actor* actorToAdd, u8 actorCate
     Actor* prevHead;
 
     actorToAdd->category = actorCategory;
+    Actor_AddToIdIndex(actorCtx, actorToAdd);
 
     actorCtx->total++;
     actorCtx->actorLists[actorCategory].length++;
@@ -3085,6 +3174,7 @@ Actor* Actor_RemoveFromCategory(PlayState* play, ActorContext* actorCtx, Actor*
 
     actorCtx->total--;
     actorCtx->actorLists[actorToRemove->category].length--;
+    Actor_RemoveFromIdIndex(actorCtx, actorToRemove);
 
     if (actorToRemove->prev != NULL) {
         actorToRemove->prev->next = actorToRemove->next;
@@ -3441,7 +3531,19 @@ Actor* func_80032AF0(PlayState* play, ActorContext* actorCtx, Actor** actorPtr,
  * Finds the first actor instance of a specified ID and category if there is one.
  */
 Actor* Actor_Find(ActorContext* actorCtx, s32 actorId, s32 actorCategory) {
-    Actor* actor = actorCtx->actorLists[actorCategory].head;
+    Actor* actor;
+
+    if (actorId >= 0 && actorId < ACTOR_ID_MAX) {
+        for (actor = actorCtx->actorIdIndex[actorId]; actor != NULL; actor = actor->nextById) {
+            if (actor->category == actorCategory) {
+                return actor;
+            }
+        }
+
+        return NULL;
+    }
+
+    actor = actorCtx->actorLists[actorCategory].head;
 
     while (actor != NULL) {
         if (actorId == actor->id) {
@@ -4495,7 +4597,20 @@ u8 func_800353E8(PlayState* play) {
  * specified category rather than a specific ID.
  */
 Actor* Actor_FindNearby(PlayState* play, Actor* refActor, s16 actorId, u8 actorCategory, f32 range) {
-    Actor* actor = play->actorCtx.actorLists[actorCategory].head;
+    Actor* actor;
+
+    if (actorId >= 0 && actorId < ACTOR_ID_MAX) {
+        for (actor = play->actorCtx.actorIdIndex[actorId]; actor != NULL; actor = actor->nextById) {
+            if ((actor->category == actorCategory) && (actor != refActor) &&
+                (Actor_WorldDistXYZToActor(refActor, actor) <= range)) {
+                return actor;
+            }
+        }
+
+        return NULL;
+    }
+
+    actor = play->actorCtx.actorLists[actorCategory].head;
 
     while (actor != NULL) {
         if (actor == refActor || ((actorId != -1) && (actorId != actor->id))) {
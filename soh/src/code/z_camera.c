@@ -207,6 +207,106 @@ Vec3f* Camera_Vec3fTranslateByUnitVector(Vec3f* dest, Vec3f* src, Vec3f* unitVec
     return dest;
 }
 
+#define CAM_COL_CACHE_SIZE 8
+
+typedef struct {
+    Vec3f from;
+    Vec3f to;
+    Vec3f result;
+    CollisionPoly* poly;
+    s32 bgId;
+    s32 chkOneFace;
+    s32 hit;
+} CamLineTestCacheEntry;
+
+typedef struct {
+    Vec3f pos;
+    CollisionPoly* poly;
+    s32 bgId;
+    f32 floorY;
+    u8 isEntity;
+} CamFloorCacheEntry;
+
+// Collision does not change while a camera updates, but its modes repeat the same at/eye queries several times.
+// Queries with bit-identical inputs are answered from here for the duration of one Camera_Update.
+static struct {
+    u8 active;
+    u8 numLineTests;
+    u8 numFloors;
+    CamLineTestCacheEntry lineTests[CAM_COL_CACHE_SIZE];
+    CamFloorCacheEntry floors[CAM_COL_CACHE_SIZE];
+} sCamColCache;
+
+static s32 Camera_LineTest(CollisionContext* colCtx, Vec3f* from, Vec3f* to, Vec3f* result, CollisionPoly** outPoly,
+                           s32 chkOneFace, s32* bgId) {
+    CamLineTestCacheEntry* entry;
+    s32 hit;
+    s32 i;
+
+    if (!sCamColCache.active) {
+        return BgCheck_CameraLineTest1(colCtx, from, to, result, outPoly, 1, 1, 1, chkOneFace, bgId);
+    }
+
+    for (i = 0; i < sCamColCache.numLineTests; i++) {
+        entry = &sCamColCache.lineTests[i];
+        if (entry->chkOneFace == chkOneFace && memcmp(&entry->from, from, sizeof(Vec3f)) == 0 &&
+            memcmp(&entry->to, to, sizeof(Vec3f)) == 0) {
+            *result = entry->result;
+            *outPoly = entry->poly;
+            *bgId = entry->bgId;
+            return entry->hit;
+        }
+    }
+
+    hit = BgCheck_CameraLineTest1(colCtx, from, to, result, outPoly, 1, 1, 1, chkOneFace, bgId);
+
+    if (sCamColCache.numLineTests < CAM_COL_CACHE_SIZE) {
+        entry = &sCamColCache.lineTests[sCamColCache.numLineTests++];
+        entry->from = *from;
+        entry->to = *to;
+        entry->result = *result;
+        entry->poly = *outPoly;
+        entry->bgId = *bgId;
+        entry->chkOneFace = chkOneFace;
+        entry->hit = hit;
+    }
+
+    return hit;
+}
+
+static f32 Camera_RaycastFloor(CollisionContext* colCtx, CollisionPoly** outPoly, s32* bgId, Vec3f* pos,
+                               u8 isEntity) {
+    CamFloorCacheEntry* entry;
+    f32 floorY;
+    s32 i;
+
+    if (sCamColCache.active) {
+        for (i = 0; i < sCamColCache.numFloors; i++) {
+            entry = &sCamColCache.floors[i];
+            if (entry->isEntity == isEntity && memcmp(&entry->pos, pos, sizeof(Vec3f)) == 0) {
+                *outPoly = entry->poly;
+                *bgId = entry->bgId;
+                return entry->floorY;
+            }
+        }
+    }
+
+    // Entity and camera raycasts ignore different poly flags, so they are cached separately
+    floorY = isEntity ? BgCheck_EntityRaycastFloor3(colCtx, outPoly, bgId, pos)
+                      : BgCheck_CameraRaycastFloor2(colCtx, outPoly, bgId, pos);
+
+    if (sCamColCache.active && sCamColCache.numFloors < CAM_COL_CACHE_SIZE) {
+        entry = &sCamColCache.floors[sCamColCache.numFloors++];
+        entry->pos = *pos;
+        entry->poly = *outPoly;
+        entry->bgId = *bgId;
+        entry->floorY = floorY;
+        entry->isEntity = isEntity;
+    }
+
+    return floorY;
+}
+
 /**
  * Detects the collision poly between `from` and `to`, places collision info in `to`
  */
@@ -224,7 +324,7 @@ s32 Camera_BGCheckInfo(Camera* camera, Vec3f* from, CamColChk* to) {
     fromToOffset.r += 8.0f;
     Camera_Vec3fVecSphGeoAdd(&toPoint, from, &fromToOffset);
 
-    if (!BgCheck_CameraLineTest1(colCtx, from, &toPoint, &toNewPos, &to->poly, 1, 1, 1, -1, &to->bgId)) {
+    if (!Camera_LineTest(colCtx, from, &toPoint, &toNewPos, &to->poly, -1, &to->bgId)) {
         // no poly in path.
         OLib_Vec3fDistNormalize(&fromToNorm, from, &to->pos);
 
@@ -234,7 +334,7 @@ s32 Camera_BGCheckInfo(Camera* camera, Vec3f* from, CamColChk* to) {
 
         toNewPos = to->pos;
         toNewPos.y += 5.0f;
-        floorPolyY = BgCheck_CameraRaycastFloor2(colCtx, &floorPoly, &floorBgId, &toNewPos);
+        floorPolyY = Camera_RaycastFloor(colCtx, &floorPoly, &floorBgId, &toNewPos, false);
 
         if ((to->pos.y - floorPolyY) > 5.0f) {
             // if the y distance from the check point to the floor is more than 5 units
@@ -287,14 +387,14 @@ s32 func_80043F94(Camera* camera, Vec3f* from, CamColChk* to) {
     OLib_Vec3fDiffToVecSphGeo(&fromToGeo, from, &to->pos);
     fromToGeo.r += 8.0f;
     Camera_Vec3fVecSphGeoAdd(&toPos, from, &fromToGeo);
-    if (!BgCheck_CameraLineTest1(colCtx, from, &toPos, &toNewPos, &to->poly, 1, 1, 1, -1, &to->bgId)) {
+    if (!Camera_LineTest(colCtx, from, &toPos, &toNewPos, &to->poly, -1, &to->bgId)) {
         OLib_Vec3fDistNormalize(&fromToNorm, from, &to->pos);
         to->norm.x = -fromToNorm.x;
         to->norm.y = -fromToNorm.y;
         to->norm.z = -fromToNorm.z;
         toNewPos = to->pos;
         toNewPos.y += 5.0f;
-        floorY = BgCheck_CameraRaycastFloor2(colCtx, &floorPoly, &bgId, &toNewPos);
+        floorY = Camera_RaycastFloor(colCtx, &floorPoly, &bgId, &toNewPos, false);
         if ((to->pos.y - floorY) > 5.0f) {
             // to is not on the ground or below it.
             to->pos.x += to->norm.x;
@@ -362,7 +462,7 @@ s32 Camera_CheckOOB(Camera* camera, Vec3f* from, Vec3f* to) {
     CollisionContext* colCtx = &camera->play->colCtx;
 
     poly = NULL;
-    if (BgCheck_CameraLineTest1(colCtx, from, to, &intersect, &poly, 1, 1, 1, 0, &bgId) &&
+    if (Camera_LineTest(colCtx, from, to, &intersect, &poly, 0, &bgId) &&
         (CollisionPoly_GetPointDistanceFromPlane(poly, from) < 0.0f)) {
         // if there is a poly between `from` and `to` and the `from` is behind the poly.
         return true;
@@ -378,7 +478,7 @@ s32 Camera_CheckOOB(Camera* camera, Vec3f* from, Vec3f* to) {
 f32 Camera_GetFloorYNorm(Camera* camera, Vec3f* floorNorm, Vec3f* chkPos, s32* bgId) {
     s32 pad;
     CollisionPoly* floorPoly;
-    f32 floorY = BgCheck_EntityRaycastFloor3(&camera->play->colCtx, &floorPoly, bgId, chkPos);
+    f32 floorY = Camera_RaycastFloor(&camera->play->colCtx, &floorPoly, bgId, chkPos, true);
 
     if (floorY == BGCHECK_Y_MIN) {
         // no floor
@@ -419,7 +519,7 @@ f32 Camera_GetFloorYLayer(Camera* camera, Vec3f* norm, Vec3f* pos, s32* bgId) {
     s32 i;
 
     for (i = 3; i > 0; i--) {
-        floorY = BgCheck_CameraRaycastFloor2(colCtx, &floorPoly, bgId, pos);
+        floorY = Camera_RaycastFloor(colCtx, &floorPoly, bgId, pos, false);
         if (floorY == BGCHECK_Y_MIN ||
             (camera->playerGroundY < floorY && !(COLPOLY_GET_NORMAL(floorPoly->normal.y) > 0.5f))) {
             // no floor, or player is below the floor and floor is not considered steep
@@ -7469,7 +7569,21 @@ void Camera_UpdateDistortion(Camera* camera) {
 }
 
 s32 sOOBTimer = 0;
+static Vec3s Camera_UpdateImpl(Camera* camera);
+
 Vec3s Camera_Update(Camera* camera) {
+    Vec3s inputDir;
+
+    sCamColCache.numLineTests = 0;
+    sCamColCache.numFloors = 0;
+    sCamColCache.active = true;
+    inputDir = Camera_UpdateImpl(camera);
+    sCamColCache.active = false;
+
+    return inputDir;
+}
+
+static Vec3s Camera_UpdateImpl(Camera* camera) {
     Vec3f viewAt;
     Vec3f viewEye;
     Vec3f viewUp;
@@ -6,6 +6,86 @@
 
 EffectSsInfo sEffectSsInfo = { 0 }; // "EffectSS2Info"
 
+#define EFFECT_SS_MAX_SLOTS 128
+#define EFFECT_SS_OCCUPIED_WORDS (EFFECT_SS_MAX_SLOTS / 64)
+
+// One bit per table slot, set while the slot holds a live effect (life != -1). Effects can kill themselves by writing
+// life directly, so the bit is resynced after every init, update and draw call. Only the slot whose init is running can
+// briefly disagree with its bit, and slot searches double check life to match the original linear scan exactly.
+// The bitmap lives outside the game state heap, so anything that restores the table behind its back (save states)
+// must call EffectSs_RebuildOccupied.
+static u64 sEffectSsOccupied[EFFECT_SS_OCCUPIED_WORDS];
+static s32 sEffectSsNumActive;
+static s32 sEffectSsHighWaterMark;
+
+static void EffectSs_SetOccupied(s32 index, s32 occupied) {
+    u64 bit = 1ULL << (index % 64);
+
+    if (occupied) {
+        if (!(sEffectSsOccupied[index / 64] & bit)) {
+            sEffectSsOccupied[index / 64] |= bit;
+            sEffectSsNumActive++;
+
+            if (sEffectSsNumActive > sEffectSsHighWaterMark) {
+                sEffectSsHighWaterMark = sEffectSsNumActive;
+            }
+        }
+    } else if (sEffectSsOccupied[index / 64] & bit) {
+        sEffectSsOccupied[index / 64] &= ~bit;
+        sEffectSsNumActive--;
+    }
+}
+
+static void EffectSs_SyncOccupied(s32 index) {
+    EffectSs_SetOccupied(index, sEffectSsInfo.table[index].life != -1);
+}
+
+/**
+ * Returns the first slot at or after `index` whose occupied bit matches `occupied`, or tableSize if there is none
+ */
+static s32 EffectSs_NextSlot(s32 index, s32 occupied) {
+    while (index < sEffectSsInfo.tableSize) {
+        u64 word = sEffectSsOccupied[index / 64];
+
+        if (!occupied) {
+            word = ~word;
+        }
+        word >>= index % 64;
+
+        if (word == 0) {
+            index = (index / 64 + 1) * 64;
+            continue;
+        }
+
+        while (!(word & 1)) {
+            word >>= 1;
+            index++;
+        }
+        break;
+    }
+
+    return MIN(index, sEffectSsInfo.tableSize);
+}
+
+void EffectSs_RebuildOccupied(void) {
+    s32 i;
+
+    memset(sEffectSsOccupied, 0, sizeof(sEffectSsOccupied));
+    sEffectSsNumActive = 0;
+
+    for (i = 0; i < sEffectSsInfo.tableSize; i++) {
+        EffectSs_SyncOccupied(i);
+    }
+}
+
+s32 EffectSs_GetNumActive(void) {
+    return sEffectSsNumActive;
+}
+
+s32 EffectSs_GetHighWaterMark(void) {
+    return sEffectSsHighWaterMark;
+}
+
 void EffectSs_InitInfo(PlayState* play, s32 tableSize) {
     u32 i;
     EffectSs* effectSs;
@@ -17,10 +97,15 @@ void EffectSs_InitInfo(PlayState* play, s32 tableSize) {
                      (uintptr_t)overlay->vramEnd - (uintptr_t)overlay->vramStart, overlay->vromEnd - overlay->vromStart);
     }
 
+    assert(tableSize <= EFFECT_SS_MAX_SLOTS);
     sEffectSsInfo.table =
         GAMESTATE_ALLOC_MC(&play->state, tableSize * sizeof(EffectSs));
     assert(sEffectSsInfo.table != NULL);
 
+    memset(sEffectSsOccupied, 0, sizeof(sEffectSsOccupied));
+    sEffectSsNumActive = 0;
+    sEffectSsHighWaterMark = 0;
+
     sEffectSsInfo.searchStartIndex = 0;
     sEffectSsInfo.tableSize = tableSize;
 
@@ -44,6 +129,8 @@ void EffectSs_ClearAll(PlayState* play) {
     sEffectSsInfo.table = NULL;
     sEffectSsInfo.searchStartIndex = 0;
     sEffectSsInfo.tableSize = 0;
+    memset(sEffectSsOccupied, 0, sizeof(sEffectSsOccupied));
+    sEffectSsNumActive = 0;
 
     // This code doesn't actually work, since table was just set to NULL and tableSize to 0
     for (effectSs = &sEffectSsInfo.table[0]; effectSs < &sEffectSsInfo.table[sEffectSsInfo.tableSize]; effectSs++) {
@@ -94,6 +181,12 @@ void EffectSs_Reset(EffectSs* effectSs) {
     for (i = 0; i < ARRAY_COUNT(effectSs->regs); i++) {
         effectSs->regs[i] = 0;
     }
+
+    // Effects can also be reset outside of the table, such as the temporary copy used by EffectSs_Insert
+    if (sEffectSsInfo.table != NULL && effectSs >= sEffectSsInfo.table &&
+        effectSs < &sEffectSsInfo.table[sEffectSsInfo.tableSize]) {
+        EffectSs_SetOccupied(effectSs - sEffectSsInfo.table, false);
+    }
 }
 
 s32 EffectSs_FindSlot(s32 priority, s32* pIndex) {
@@ -104,24 +197,22 @@ s32 EffectSs_FindSlot(s32 priority, s32* pIndex) {
         sEffectSsInfo.searchStartIndex = 0;
     }
 
-    // Search for a free slot
-    i = sEffectSsInfo.searchStartIndex;
+    // Search for a free slot, starting at searchStartIndex and wrapping around the table
     foundFree = false;
-    while (true) {
+    for (i = EffectSs_NextSlot(sEffectSsInfo.searchStartIndex, false); i < sEffectSsInfo.tableSize;
+         i = EffectSs_NextSlot(i + 1, false)) {
         if (sEffectSsInfo.table[i].life == -1) {
             foundFree = true;
             break;
         }
+    }
 
-        i++;
-
-        if (i >= sEffectSsInfo.tableSize) {
-            i = 0; // Loop around the whole table
-        }
-
-        // After a full loop, break out
-        if (i == sEffectSsInfo.searchStartIndex) {
-            break;
+    if (!foundFree) {
+        for (i = EffectSs_NextSlot(0, false); i < sEffectSsInfo.searchStartIndex; i = EffectSs_NextSlot(i + 1, false)) {
+            if (sEffectSsInfo.table[i].life == -1) {
+                foundFree = true;
+                break;
+            }
         }
     }
 
@@ -163,6 +254,7 @@ void EffectSs_Insert(PlayState* play, EffectSs* effectSs) {
         if (EffectSs_FindSlot(effectSs->priority, &index) == 0) {
             sEffectSsInfo.searchStartIndex = index + 1;
             sEffectSsInfo.table[index] = *effectSs;
+            EffectSs_SyncOccupied(index);
         }
     }
 }
@@ -247,6 +339,8 @@ void EffectSs_Spawn(PlayState* play, s32 type, s32 priority, void* initParams) {
                      "止します。\n");
         osSyncPrintf(VT_RST);
         EffectSs_Reset(&sEffectSsInfo.table[index]);
+    } else {
+        EffectSs_SyncOccupied(index);
     }
 }
 
@@ -263,13 +357,16 @@ void EffectSs_Update(PlayState* play, s32 index) {
         effectSs->pos.z += effectSs->velocity.z;
 
         effectSs->update(play, index, effectSs);
+        EffectSs_SyncOccupied(index);
     }
 }
 
 void EffectSs_UpdateAll(PlayState* play) {
     s32 i;
 
-    for (i = 0; i < sEffectSsInfo.tableSize; i++) {
+    // Only live slots are visited. Effects spawned during the pass are picked up like in the full table scan since the
+    // next slot is looked up after each update.
+    for (i = EffectSs_NextSlot(0, true); i < sEffectSsInfo.tableSize; i = EffectSs_NextSlot(i + 1, true)) {
         if (sEffectSsInfo.table[i].life > -1) {
             sEffectSsInfo.table[i].life--;
 
@@ -291,6 +388,7 @@ void EffectSs_Draw(PlayState* play, s32 index) {
         FrameInterpolation_RecordOpenChild(effectSs, effectSs->epoch);
         effectSs->draw(play, index, effectSs);
         FrameInterpolation_RecordCloseChild();
+        EffectSs_SyncOccupied(index);
     }
 }
 
@@ -302,7 +400,7 @@ void EffectSs_DrawAll(PlayState* play) {
     Lights_BindAll(lights, play->lightCtx.listHead, NULL);
     Lights_Draw(lights, play->state.gfxCtx);
 
-    for (i = 0; i < sEffectSsInfo.tableSize; i++) {
+    for (i = EffectSs_NextSlot(0, true); i < sEffectSsInfo.tableSize; i = EffectSs_NextSlot(i + 1, true)) {
         if (sEffectSsInfo.table[i].life > -1) {
             if ((sEffectSsInfo.table[i].pos.x > 32000.0f) || (sEffectSsInfo.table[i].pos.x < -32000.0f) ||
                 (sEffectSsInfo.table[i].pos.y > 32000.0f) || (sEffectSsInfo.table[i].pos.y < -32000.0f) ||
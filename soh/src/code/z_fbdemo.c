@@ -167,17 +167,15 @@ TransitionUnk* TransitionUnk_Init(TransitionUnk* this, s32 row, s32 col) {
 }
 
 void TransitionUnk_SetData(TransitionUnk* this) {
-    s32 col;
-    Vtx* vtx;
-    s32 row;
-
-    for (col = 0; col < this->col + 1; col++) {
-        for (row = 0; row < this->row + 1; row++) {
-            vtx = (this->frame == 0) ? this->vtxFrame1 : this->vtxFrame2;
-            (vtx + row + col * (this->row + 1))->v.ob[0] = (this->unk_0C + row + col * (this->row + 1))->unk_0;
-            vtx = (this->frame == 0) ? this->vtxFrame1 : this->vtxFrame2;
-            (vtx + row + col * (this->row + 1))->v.ob[1] = (this->unk_0C + row + col * (this->row + 1))->unk_4;
-        }
+    // The grid is stored row-major with no padding, so walk it as one flat array
+    Vtx* vtx = (this->frame == 0) ? this->vtxFrame1 : this->vtxFrame2;
+    TransitionUnkData* data = this->unk_0C;
+    s32 count = (this->row + 1) * (this->col + 1);
+    s32 i;
+
+    for (i = 0; i < count; i++) {
+        vtx[i].v.ob[0] = data[i].unk_0;
+        vtx[i].v.ob[1] = data[i].unk_4;
     }
 }
 
@@ -198,26 +196,29 @@ void TransitionUnk_Draw(TransitionUnk* this, Gfx** gfxP) {
 }
 
 void TransitionUnk_Update(TransitionUnk* this) {
+    TransitionUnkData* data = this->unk_0C;
+    s32 count = (this->row + 1) * (this->col + 1);
+    f32 centerX;
+    f32 centerY;
     f32 temp_f00;
     f32 temp_f12;
-    s32 col;
     f32 phi_f14;
-    s32 row;
-
-    for (col = 0; col < this->col + 1; col++) {
-        for (row = 0; row < this->row + 1; row++) {
-            temp_f00 =
-                (this->unk_0C + row + col * (this->row + 1))->unk_0 - (this->unk_0C + 5 + 4 * (this->row + 1))->unk_0;
-            temp_f12 =
-                (this->unk_0C + row + col * (this->row + 1))->unk_4 - (this->unk_0C + 5 + 4 * (this->row + 1))->unk_4;
-            phi_f14 = (SQ(temp_f00) + SQ(temp_f12)) / 100.0f;
-            if (phi_f14 != 0.0f) {
-                if (phi_f14 < 1.0f) {
-                    phi_f14 = 1.0f;
-                }
-                (this->unk_0C + row + col * (this->row + 1))->unk_0 -= temp_f00 / phi_f14;
-                (this->unk_0C + row + col * (this->row + 1))->unk_4 -= temp_f12 / phi_f14;
+    s32 i;
+
+    // The center point has zero distance to itself and is never moved, so it can be read once up front
+    centerX = data[5 + 4 * (this->row + 1)].unk_0;
+    centerY = data[5 + 4 * (this->row + 1)].unk_4;
+
+    for (i = 0; i < count; i++) {
+        temp_f00 = data[i].unk_0 - centerX;
+        temp_f12 = data[i].unk_4 - centerY;
+        phi_f14 = (SQ(temp_f00) + SQ(temp_f12)) / 100.0f;
+        if (phi_f14 != 0.0f) {
+            if (phi_f14 < 1.0f) {
+                phi_f14 = 1.0f;
             }
+            data[i].unk_0 -= temp_f00 / phi_f14;
+            data[i].unk_4 -= temp_f12 / phi_f14;
         }
     }
 }
@@ -9,6 +9,12 @@ Gfx sCircleNullDList[] = {
 //#include "code/fbdemo_circle/z_fbdemo_circle.c"
 #include "code/fbdemo_circle/z_fbdemo_circle.h"
 
+static ResourceHandle sTransCircleVtxHandle = RESOURCE_HANDLE(sTransCircleVtx);
+
+// Vertex pointer currently patched into __sCircleDList and the aspect ratio each model view buffer was built for
+static Vtx* sCircleDListVtx = NULL;
+static f32 sCircleBuiltAspectRatio[2];
+
 Gfx __sCircleDList[] = {
     gsDPPipeSync(),                                                                                                 // 0
     gsSPClearGeometryMode(G_ZBUFFER | G_SHADE | G_CULL_BOTH | G_FOG | G_LIGHTING | G_TEXTURE_GEN |                  // 1
@@ -95,6 +101,7 @@ void* TransitionCircle_Init(void* thisx) {
     TransitionCircle* this = (TransitionCircle*)thisx;
 
     memset(this, 0, sizeof(*this));
+    sCircleBuiltAspectRatio[0] = sCircleBuiltAspectRatio[1] = 0.0f;
     return this;
 }
 
@@ -142,8 +149,9 @@ void TransitionCircle_Draw(void* thisx, Gfx** gfxP) {
     f32 tPos = 0.0f;
     f32 rot = 0.0f;
     f32 scale = 14.8f;
+    s32 frame = this->frame;
 
-    modelView = this->modelView[this->frame];
+    modelView = this->modelView[frame];
 
     this->frame ^= 1;
     gDPPipeSync(gfx++);
@@ -159,7 +167,11 @@ void TransitionCircle_Draw(void* thisx, Gfx** gfxP) {
     float aspectRatio = OTRGetAspectRatio();
 
     if (scale != 1.0f) {
-        guScale(&modelView[0], scale * aspectRatio, scale * aspectRatio, 1.0f);
+        // Only the window aspect ratio can change the scale, so skip rebuilding it on every draw
+        if (sCircleBuiltAspectRatio[frame] != aspectRatio) {
+            guScale(&modelView[0], scale * aspectRatio, scale * aspectRatio, 1.0f);
+            sCircleBuiltAspectRatio[frame] = aspectRatio;
+        }
         gSPMatrix(gfx++, &modelView[0], G_MTX_LOAD);
     }
 
@@ -174,11 +186,14 @@ void TransitionCircle_Draw(void* thisx, Gfx** gfxP) {
     }
 
     // OTRTODO: This is an ugly hack but it will do for now...
-    Vtx* vtx = ResourceMgr_LoadVtxByName(sTransCircleVtx);
-    Gfx var1 = gsSPVertex(vtx, 32, 0);
-    Gfx var2 = gsSPVertex(&vtx[31], 3, 0);
-    __sCircleDList[0xe] = var1;
-    __sCircleDList[0x17] = var2;
+    Vtx* vtx = ResourceMgr_LoadVtxByHandle(&sTransCircleVtxHandle);
+    if (vtx != sCircleDListVtx) {
+        Gfx var1 = gsSPVertex(vtx, 32, 0);
+        Gfx var2 = gsSPVertex(&vtx[31], 3, 0);
+        __sCircleDList[0xe] = var1;
+        __sCircleDList[0x17] = var2;
+        sCircleDListVtx = vtx;
+    }
 
     gSPDisplayList(gfx++, __sCircleDList);
     gDPPipeSync(gfx++);
@@ -3,6 +3,9 @@
 
 #include "code/fbdemo_triforce/z_fbdemo_triforce.h"
 
+// transPos each model view buffer was last built for, so interpolated frames between updates can reuse it
+static f32 sTriforceBuiltPos[2];
+
 void TransitionTriforce_Start(void* thisx) {
     TransitionTriforce* this = (TransitionTriforce*)thisx;
 
@@ -19,6 +22,7 @@ void* TransitionTriforce_Init(void* thisx) {
     TransitionTriforce* this = (TransitionTriforce*)thisx;
 
     memset(this,0, sizeof(*this));
+    sTriforceBuiltPos[0] = sTriforceBuiltPos[1] = -1.0f;
     guOrtho(&this->projection, -160.0f, 160.0f, -120.0f, 120.0f, -1000.0f, 1000.0f, 1.0f);
     this->transPos = 1.0f;
     this->state = 2;
@@ -77,11 +81,14 @@ void TransitionTriforce_Draw(void* thisx, Gfx** gfxP) {
 
     modelView = this->modelView[this->frame];
     scale = this->transPos * 0.625f;
-    this->frame ^= 1;
     osSyncPrintf("rate=%f tx=%f ty=%f rotate=%f\n", this->transPos, 0.0f, 0.0f, rotation);
-    guScale(&modelView[0], scale, scale, 1.0f);
-    guRotate(&modelView[1], rotation, 0.0f, 0.0f, 1.0f);
-    guTranslate(&modelView[2], 0.0f, 0.0f, 0.0f);
+    if (sTriforceBuiltPos[this->frame] != this->transPos) {
+        guScale(&modelView[0], scale, scale, 1.0f);
+        guRotate(&modelView[1], rotation, 0.0f, 0.0f, 1.0f);
+        guTranslate(&modelView[2], 0.0f, 0.0f, 0.0f);
+        sTriforceBuiltPos[this->frame] = this->transPos;
+    }
+    this->frame ^= 1;
     gDPPipeSync(gfx++);
     gSPDisplayList(gfx++, sTransTriforceDL);
     gDPSetColor(gfx++, G_SETPRIMCOLOR, this->color.rgba);
@@ -39,6 +39,7 @@ Gfx sWipeSyncDList[] = {
 
 void TransitionWipe_Start(void* thisx) {
     TransitionWipe* this = (TransitionWipe*)thisx;
+    s32 i;
 
     this->isDone = 0;
 
@@ -50,6 +51,13 @@ void TransitionWipe_Start(void* thisx) {
 
     guPerspective(&this->projection, &this->normal, 60.0f, (4.0 / 3.0f), 10.0f, 12800.0f, 1.0f);
     guLookAt(&this->lookAt, 0.0f, 0.0f, 400.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+
+    // The wipe's model view never changes, so build both buffers once instead of on every draw
+    for (i = 0; i < 2; i++) {
+        guScale(&this->modelView[i][0], 0.56f, 0.56f, 1.0f);
+        guRotate(&this->modelView[i][1], 0.0f, 0.0f, 0.0f, 1.0f);
+        guTranslate(&this->modelView[i][2], 0.0f, 0.0f, 0.0f);
+    }
 }
 
 void* TransitionWipe_Init(void* thisx) {
@@ -94,9 +102,6 @@ void TransitionWipe_Draw(void* thisx, Gfx** gfxP) {
     modelView = this->modelView[this->frame];
 
     this->frame ^= 1;
-    guScale(&modelView[0], 0.56f, 0.56f, 1.0f);
-    guRotate(&modelView[1], 0.0f, 0.0f, 0.0f, 1.0f);
-    guTranslate(&modelView[2], 0.0f, 0.0f, 0.0f);
     gDPPipeSync(gfx++);
     tex = Gfx_BranchTexScroll(&gfx, this->texX, this->texY, 0, 0);
     gSPSegment(gfx++, 8, tex);
@@ -232,10 +232,15 @@ u16 Environment_GetPixelDepth(s32 x, s32 y) {
 void Environment_GraphCallback(GraphicsContext* gfxCtx, void* param) {
     PlayState* play = (PlayState*)param;
 
-    OTRGetPixelDepthPrepare(D_8015FD7E, D_8015FD80);
+    s32 sunDepthQuery;
+
+    // Queue the lens flare and light glow samples and read them back in a single batch
+    OTRDepthQuery_Begin();
+    sunDepthQuery = OTRDepthQuery_Add(D_8015FD7E, D_8015FD80);
     Lights_GlowCheckPrepare(play);
+    OTRDepthQuery_Resolve();
 
-    D_8011FB44 = Environment_GetPixelDepth(D_8015FD7E, D_8015FD80);
+    D_8011FB44 = OTRDepthQuery_Get(sunDepthQuery);
     Lights_GlowCheck(play);
 }
 
@@ -111,6 +111,12 @@ void Lights_BindPoint(Lights* lights, LightParams* params, Vec3f* vec) {
         yDiff = params->point.y - vec->y;
         zDiff = params->point.z - vec->z;
         scale = params->point.radius;
+
+        // Cheap per-axis reject, any axis at or past the radius puts the full distance out of range too
+        if (fabsf(xDiff) >= fabsf(scale) || fabsf(yDiff) >= fabsf(scale) || fabsf(zDiff) >= fabsf(scale)) {
+            return;
+        }
+
         posDiff = SQ(xDiff) + SQ(yDiff) + SQ(zDiff);
 
         if (posDiff < SQ(scale)) {
@@ -157,10 +163,11 @@ void Lights_BindDirectional(Lights* lights, LightParams* params, Vec3f* vec) {
  * available in the Lights group. This is at most 7 slots for a new group, but could be less.
  */
 void Lights_BindAll(Lights* lights, LightNode* listHead, Vec3f* vec) {
-    LightsBindFunc bindFuncs[] = { Lights_BindPoint, Lights_BindDirectional, Lights_BindPoint };
+    static const LightsBindFunc bindFuncs[] = { Lights_BindPoint, Lights_BindDirectional, Lights_BindPoint };
     LightInfo* info;
 
-    while (listHead != NULL) {
+    // Binding stops having any effect once every slot is taken, so there is no need to visit the remaining lights
+    while (listHead != NULL && lights->numLights < 7) {
         info = listHead->info;
         // OTRTODO: we do not know the root cause of the info->type value being invalid
         // but this prevents it from crashing the game on the game over screen
@@ -326,6 +333,19 @@ Lights* Lights_New(GraphicsContext* gfxCtx, u8 ambientR, u8 ambientG, u8 ambient
     return lights;
 }
 
+typedef struct {
+    LightPoint* params;
+    s32 wZ;
+    s32 depthQuery;
+} LightGlowQuery;
+
+static LightGlowQuery sGlowQueries[LIGHTS_BUFFER_SIZE];
+static s32 sNumGlowQueries;
+
+/**
+ * Projects every glowing light and adds a depth query for the visible ones to the current frame's batch.
+ * Must be called between OTRDepthQuery_Begin and OTRDepthQuery_Resolve.
+ */
 void Lights_GlowCheckPrepare(PlayState* play) {
     LightNode* node;
     LightPoint* params;
@@ -336,6 +356,7 @@ void Lights_GlowCheckPrepare(PlayState* play) {
     f32 wY;
 
     node = play->lightCtx.listHead;
+    sNumGlowQueries = 0;
 
     while (node != NULL) {
         params = &node->info->params.point;
@@ -343,12 +364,12 @@ void Lights_GlowCheckPrepare(PlayState* play) {
         if (node->info->type == LIGHT_POINT_GLOW) {
             f32 x, y;
             u32 shrink;
-            uint32_t height;
 
             pos.x = params->x;
             pos.y = params->y;
             pos.z = params->z;
             func_8002BE04(play, &pos, &multDest, &wDest);
+            params->drawGlow = false;
             wX = multDest.x * wDest;
             wY = multDest.y * wDest;
 
@@ -356,58 +377,36 @@ void Lights_GlowCheckPrepare(PlayState* play) {
             y = wY * 120 + 120;
             shrink = ShrinkWindow_GetCurrentVal();
 
-            if ((multDest.z > 1.0f) && y >= shrink && y <= SCREEN_HEIGHT - shrink) {
-                OTRGetPixelDepthPrepare(x, y);
+            if ((multDest.z > 1.0f) && y >= shrink && y <= SCREEN_HEIGHT - shrink &&
+                sNumGlowQueries < ARRAY_COUNT(sGlowQueries)) {
+                LightGlowQuery* query = &sGlowQueries[sNumGlowQueries++];
+
+                query->params = params;
+                query->wZ = (s32)((multDest.z * wDest) * 16352.0f) + 16352;
+                query->depthQuery = OTRDepthQuery_Add(x, y);
             }
         }
         node = node->next;
     }
 }
 
+/**
+ * Sets drawGlow for the lights queried in Lights_GlowCheckPrepare once the depth batch has been resolved.
+ */
 void Lights_GlowCheck(PlayState* play) {
-    LightNode* node;
-    LightPoint* params;
-    Vec3f pos;
-    Vec3f multDest;
-    f32 wDest;
-    f32 wX;
-    f32 wY;
-    s32 wZ;
+    s32 i;
     s32 zBuf;
 
-    node = play->lightCtx.listHead;
-
-    while (node != NULL) {
-        params = &node->info->params.point;
-
-        if (node->info->type == LIGHT_POINT_GLOW) {
-            f32 x, y;
-            u32 shrink;
-            uint32_t height;
-
-            pos.x = params->x;
-            pos.y = params->y;
-            pos.z = params->z;
-            func_8002BE04(play, &pos, &multDest, &wDest);
-            params->drawGlow = false;
-            wX = multDest.x * wDest;
-            wY = multDest.y * wDest;
+    for (i = 0; i < sNumGlowQueries; i++) {
+        LightGlowQuery* query = &sGlowQueries[i];
 
-            x = wX * 160 + 160;
-            y = wY * 120 + 120;
-            shrink = ShrinkWindow_GetCurrentVal();
+        zBuf = OTRDepthQuery_Get(query->depthQuery) * 4;
 
-            if ((multDest.z > 1.0f) && y >= shrink && y <= SCREEN_HEIGHT - shrink) {
-                wZ = (s32)((multDest.z * wDest) * 16352.0f) + 16352;
-                zBuf = OTRGetPixelDepth(x, y) * 4;
-        
-                if (wZ < (zBuf >> 3)) {
-                    params->drawGlow = true;
-                }
-            }
+        if (query->wZ < (zBuf >> 3)) {
+            query->params->drawGlow = true;
         }
-        node = node->next;
     }
+    sNumGlowQueries = 0;
 }
 
 void Lights_DrawGlow(PlayState* play) {
@@ -12,6 +12,7 @@
 #include <overlays/misc/ovl_kaleido_scope/z_kaleido_scope.h>
 #include "soh/Enhancements/enhancementTypes.h"
 #include "soh/Enhancements/game-interactor/GameInteractor_Hooks.h"
+#include "soh/Enhancements/headless/HeadlessMode.h"
 
 #include <libultraship/libultraship.h>
 
@@ -38,6 +39,7 @@ s16 firstInit = 0;
 s16 gEnPartnerId;
 
 void OTRPlay_SpawnScene(PlayState* play, s32 sceneNum, s32 spawn);
+void OTRScene_PrefetchEntrance(PlayState* play, s32 entranceIndex);
 
 void enableBetaQuest();
 void disableBetaQuest();
@@ -634,7 +636,8 @@ void Play_Init(GameState* thisx) {
     }
 
     FrameAdvance_Init(&play->frameAdvCtx);
-    Rand_Seed((u32)osGetTime());
+    // Recorded and replayed sessions need the same RNG sequence to stay in sync with their input
+    Rand_Seed(HeadlessMode_IsDeterministic() ? 0 : (u32)osGetTime());
     Matrix_Init(&play->state);
     play->state.main = Play_Main;
     play->state.destroy = Play_Destroy;
@@ -868,6 +871,9 @@ void Play_Update(PlayState* play) {
                             sp6E = (gSaveContext.cutsceneIndex & 0xF) + 4;
                         }
 
+                        // Start loading the destination scene while the transition plays out
+                        OTRScene_PrefetchEntrance(play, play->nextEntranceIndex + sp6E);
+
                         if (!(gEntranceTable[play->nextEntranceIndex + sp6E].field & ENTRANCE_INFO_CONTINUE_BGM_FLAG)) { // Continue BGM Off
                             // "Sound initalized. 111"
                             osSyncPrintf("\n\n\nサウンドイニシャル来ました。111");
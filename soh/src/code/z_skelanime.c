@@ -470,12 +470,59 @@ void SkelAnime_DrawFlexOpa(PlayState* play, void** skeleton, Vec3s* jointTable,
     CLOSE_DISPS(play->state.gfxCtx);
 }
 
+#define POSE_CACHE_SIZE 64
+#define POSE_CACHE_MAX_LIMBS 64
+
+typedef struct {
+    AnimationHeader* animation;
+    s32 frame;
+    s32 limbCount;
+    u32 generation;
+    Vec3s pose[POSE_CACHE_MAX_LIMBS];
+} PoseCacheEntry;
+
+// Decoded poses keyed by (animation, frame). NPCs sharing an animation usually sit on the same frame, so they copy
+// the pose decoded for the first one instead of resolving the animation by name and decoding it again.
+static PoseCacheEntry sPoseCache[POSE_CACHE_SIZE];
+
+static PoseCacheEntry* SkelAnime_GetPoseCacheEntry(AnimationHeader* animation, s32 frame) {
+    uintptr_t hash = ((uintptr_t)animation >> 3) ^ ((u32)frame * 0x9E3779B1);
+
+    return &sPoseCache[(hash ^ (hash >> 16)) % POSE_CACHE_SIZE];
+}
+
+static void SkelAnime_DecodeFrameData(AnimationHeader* animation, s32 frame, s32 limbCount, Vec3s* frameTable);
+
 /**
  * Copies frame data from the frame data table, indexed by the joint index table.
  * Indices below limit are copied from that entry in the static frame data table.
  * Indices above limit are offsets to a frame data array indexed by the frame.
  */
 void SkelAnime_GetFrameData(AnimationHeader* animation, s32 frame, s32 limbCount, Vec3s* frameTable) {
+    PoseCacheEntry* entry;
+    u32 generation;
+
+    if (limbCount > POSE_CACHE_MAX_LIMBS) {
+        SkelAnime_DecodeFrameData(animation, frame, limbCount, frameTable);
+        return;
+    }
+
+    entry = SkelAnime_GetPoseCacheEntry(animation, frame);
+    generation = ResourceMgr_GetHandleGeneration();
+
+    if (entry->animation != animation || entry->frame != frame || entry->limbCount != limbCount ||
+        entry->generation != generation) {
+        SkelAnime_DecodeFrameData(animation, frame, limbCount, entry->pose);
+        entry->animation = animation;
+        entry->frame = frame;
+        entry->limbCount = limbCount;
+        entry->generation = generation;
+    }
+
+    memcpy(frameTable, entry->pose, sizeof(Vec3s) * limbCount);
+}
+
+static void SkelAnime_DecodeFrameData(AnimationHeader* animation, s32 frame, s32 limbCount, Vec3s* frameTable) {
     if (ResourceMgr_OTRSigCheck(animation) != 0)
         animation = ResourceMgr_LoadAnimByName(animation);
 
@@ -857,6 +904,37 @@ AnimationEntry* AnimationContext_AddEntry(AnimationContext* animationCtx, Animat
     return entry;
 }
 
+#define PLAYER_ANIM_CACHE_SIZE 16
+
+typedef struct {
+    void* segment;
+    u32 generation;
+    s16* data;
+} PlayerAnimCacheEntry;
+
+// Resolved player animation data by segment, so streaming a frame doesn't format and look up the path every time
+static PlayerAnimCacheEntry sPlayerAnimCache[PLAYER_ANIM_CACHE_SIZE];
+
+static s16* AnimationContext_GetPlayerAnimData(LinkAnimationHeader* linkAnimHeader) {
+    PlayerAnimCacheEntry* entry =
+        &sPlayerAnimCache[((uintptr_t)linkAnimHeader->segment >> 4) % PLAYER_ANIM_CACHE_SIZE];
+    u32 generation = ResourceMgr_GetHandleGeneration();
+
+    if (entry->segment != linkAnimHeader->segment || entry->generation != generation || entry->data == NULL) {
+        char animPath[2048];
+
+        snprintf(animPath, sizeof(animPath), "misc/link_animetion/gPlayerAnimData_%06X", (((uintptr_t)linkAnimHeader->segment - 0x07000000)));
+
+        //printf("Streaming %s, seg = %08X\n", animPath, linkAnimHeader->segment);
+
+        entry->data = ResourceMgr_LoadPlayerAnimByName(animPath);
+        entry->segment = linkAnimHeader->segment;
+        entry->generation = generation;
+    }
+
+    return entry->data;
+}
+
 /**
  * Requests loading frame data from the Link animation into frameTable
  */
@@ -880,13 +958,7 @@ void AnimationContext_SetLoadFrame(PlayState* play, LinkAnimationHeader* animati
 
         osCreateMesgQueue(&entry->data.load.msgQueue, &entry->data.load.msg, 1);
 
-        char animPath[2048];
-
-        snprintf(animPath, sizeof(animPath), "misc/link_animetion/gPlayerAnimData_%06X", (((uintptr_t)linkAnimHeader->segment - 0x07000000)));
-
-        //printf("Streaming %s, seg = %08X\n", animPath, linkAnimHeader->segment);
-
-        s16* animData = ResourceMgr_LoadPlayerAnimByName(animPath);
+        s16* animData = AnimationContext_GetPlayerAnimData(linkAnimHeader);
 
         memcpy(ram, (uintptr_t)animData + (((sizeof(Vec3s) * limbCount + 2) * frame)), sizeof(Vec3s) * limbCount + 2);
 
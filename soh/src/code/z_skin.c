@@ -4,41 +4,43 @@ MtxF gSkinLimbMatrices[60]; // holds matrices for each limb of the skeleton curr
 
 static s32 sUnused;
 
+/**
+ * Sets the position of every vertex in `skinVertices` to `pos` and rotates their normals by `mtx`.
+ * The position and the rotation part of the matrix are the same for the whole set, so they are converted once up
+ * front and the per-vertex loop is left with a plain 3x3 multiply the compiler can vectorize.
+ */
 void Skin_UpdateVertices(MtxF* mtx, SkinVertex* skinVertices, SkinLimbModif* modifEntry, Vtx* vtxBuf, Vec3f* pos) {
     Vtx* vtx;
     SkinVertex* vertexEntry;
-    f32 xwTemp;
-    f32 ywTemp;
-    f32 zwTemp;
-    Vec3f normal;
-    Vec3f sp64;
+    SkinVertex* vertexEnd = &skinVertices[modifEntry->vtxCount];
+    s16 obX = pos->x;
+    s16 obY = pos->y;
+    s16 obZ = pos->z;
+    f32 xx = mtx->xx;
+    f32 xy = mtx->xy;
+    f32 xz = mtx->xz;
+    f32 yx = mtx->yx;
+    f32 yy = mtx->yy;
+    f32 yz = mtx->yz;
+    f32 zx = mtx->zx;
+    f32 zy = mtx->zy;
+    f32 zz = mtx->zz;
+
+    for (vertexEntry = skinVertices; vertexEntry < vertexEnd; vertexEntry++) {
+        f32 normX = vertexEntry->normX;
+        f32 normY = vertexEntry->normY;
+        f32 normZ = vertexEntry->normZ;
 
-    for (vertexEntry = skinVertices; vertexEntry < &skinVertices[modifEntry->vtxCount]; vertexEntry++) {
         vtx = &vtxBuf[vertexEntry->index];
 
-        vtx->n.ob[0] = pos->x;
-        vtx->n.ob[1] = pos->y;
-        vtx->n.ob[2] = pos->z;
-
-        xwTemp = mtx->xw;
-        ywTemp = mtx->yw;
-        zwTemp = mtx->zw;
-
-        mtx->xw = mtx->yw = mtx->zw = 0.0f;
-
-        sp64.x = vertexEntry->normX;
-        sp64.y = vertexEntry->normY;
-        sp64.z = vertexEntry->normZ;
-
-        SkinMatrix_Vec3fMtxFMultXYZ(mtx, &sp64, &normal);
-
-        vtx->n.n[0] = normal.x;
-        vtx->n.n[1] = normal.y;
-        vtx->n.n[2] = normal.z;
+        vtx->n.ob[0] = obX;
+        vtx->n.ob[1] = obY;
+        vtx->n.ob[2] = obZ;
 
-        mtx->xw = xwTemp;
-        mtx->yw = ywTemp;
-        mtx->zw = zwTemp;
+        // Same operation order as SkinMatrix_Vec3fMtxFMultXYZ with the translation zeroed
+        vtx->n.n[0] = (normX * xx) + (normY * xy) + (normZ * xz);
+        vtx->n.n[1] = (normX * yx) + (normY * yy) + (normZ * yz);
+        vtx->n.n[2] = (normX * zx) + (normY * zy) + (normZ * zz);
     }
 }
 
@@ -949,6 +949,29 @@ void Skybox_Setup(PlayState* play, SkyboxContext* skyboxCtx, s16 skyboxId) {
     }
 }
 
+// The skybox display lists only depend on the layout of the skybox and the texture pointers baked into them. Skybox_Update
+// is called both when the textures change and when only the palettes change, so the last built state is kept to skip
+// rebuilding identical display lists.
+static struct {
+    Gfx (*dListBuf)[150];
+    s16 skyboxId;
+    s32 unk_140;
+    void* textures[2][6];
+} sSkyboxBuiltState;
+
+static s32 Skybox_IsBuilt(SkyboxContext* skyboxCtx) {
+    return (sSkyboxBuiltState.dListBuf == skyboxCtx->dListBuf) && (sSkyboxBuiltState.skyboxId == skyboxCtx->skyboxId) &&
+           (sSkyboxBuiltState.unk_140 == skyboxCtx->unk_140) &&
+           !memcmp(sSkyboxBuiltState.textures, skyboxCtx->textures, sizeof(skyboxCtx->textures));
+}
+
+static void Skybox_SetBuilt(SkyboxContext* skyboxCtx) {
+    sSkyboxBuiltState.dListBuf = skyboxCtx->dListBuf;
+    sSkyboxBuiltState.skyboxId = skyboxCtx->skyboxId;
+    sSkyboxBuiltState.unk_140 = skyboxCtx->unk_140;
+    memcpy(sSkyboxBuiltState.textures, skyboxCtx->textures, sizeof(skyboxCtx->textures));
+}
+
 void Skybox_Init(GameState* state, SkyboxContext* skyboxCtx, s16 skyboxId) {
     PlayState* play = (PlayState*)state;
 
@@ -989,12 +1012,17 @@ void Skybox_Init(GameState* state, SkyboxContext* skyboxCtx, s16 skyboxId) {
                 func_800AF178(skyboxCtx, 5);
             }
         }
+        Skybox_SetBuilt(skyboxCtx);
         osSyncPrintf(VT_RST);
     }
 }
 
 void Skybox_Update(SkyboxContext* skyboxCtx) {
     if (skyboxCtx->skyboxId != SKYBOX_NONE) {
+        if (Skybox_IsBuilt(skyboxCtx)) {
+            return;
+        }
+
         osSyncPrintf(VT_FGCOL(GREEN));
 
         if (skyboxCtx->unk_140 != 0) {
@@ -1006,6 +1034,7 @@ void Skybox_Update(SkyboxContext* skyboxCtx) {
                 func_800AF178(skyboxCtx, 5);
             }
         }
+        Skybox_SetBuilt(skyboxCtx);
         osSyncPrintf(VT_RST);
     }
 }
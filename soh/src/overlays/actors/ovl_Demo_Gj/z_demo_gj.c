@@ -9,6 +9,8 @@
 #include "objects/object_geff/object_geff.h"
 #include "vt.h"
 
+static ResourceHandle sGanonRubbleDLHandle = RESOURCE_HANDLE(gGanonRubbleDL);
+
 #define FLAGS (ACTOR_FLAG_UPDATE_WHILE_CULLED | ACTOR_FLAG_DRAW_WHILE_CULLED)
 
 void DemoGj_Init(Actor* thisx, PlayState* play);
@@ -192,7 +194,7 @@ void DemoGj_Explode(DemoGj* this, PlayState* play, Vec3f* initialPos, Vec3f* dir
             phi_s0 = 0x21;
         }
 
-        Gfx* gfx = ResourceMgr_LoadGfxByName(gGanonRubbleDL);
+        Gfx* gfx = ResourceMgr_LoadGfxByHandle(&sGanonRubbleDLHandle);
 
         EffectSsKakera_Spawn(play, &explosionPos, &velocity, initialPos, -200, phi_s0, 10, 10, 0,
                              Rand_ZeroOne() * 20.0f + 20.0f, 20, 300, (s32)(Rand_ZeroOne() * 30.0f) + 30, -1,
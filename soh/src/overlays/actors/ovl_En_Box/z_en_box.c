@@ -767,6 +767,9 @@ void EnBox_UpdateSizeAndTexture(EnBox* this, PlayState* play) {
     }
 }
 
+static ResourceHandle sTreasureChestChestFrontDLHandle = RESOURCE_HANDLE(gTreasureChestChestFrontDL);
+static ResourceHandle sTreasureChestChestSideAndLidDLHandle = RESOURCE_HANDLE(gTreasureChestChestSideAndLidDL);
+
 void EnBox_CreateExtraChestTextures() {
     // Don't patch textures for custom chest models, as they do not import textures the exact same way as vanilla chests
     // OTRTODO: Make it so model packs can provide a unique DL per chest type, instead of us copying the brown chest and attempting to patch
@@ -793,7 +796,7 @@ void EnBox_CreateExtraChestTextures() {
         gsDPSetTextureImage(G_IM_FMT_RGBA, G_IM_SIZ_16b, 1, gChristmasGreenTreasureChestSideAndTopTex),
     };
 
-    Gfx* frontCmd = ResourceMgr_LoadGfxByName(gTreasureChestChestFrontDL);
+    Gfx* frontCmd = ResourceMgr_LoadGfxByHandle(&sTreasureChestChestFrontDLHandle);
     int frontIndex = 0;
     while (frontCmd->words.w0 >> 24 != G_ENDDL) {
         gSkullTreasureChestChestFrontDL[frontIndex] = *frontCmd;
@@ -831,7 +834,7 @@ void EnBox_CreateExtraChestTextures() {
     gChristmasGreenTreasureChestChestFrontDL[37] = gTreasureChestChestTextures[8];
     gChristmasGreenTreasureChestChestFrontDL[50] = gTreasureChestChestTextures[9];
 
-    Gfx* sideCmd = ResourceMgr_LoadGfxByName(gTreasureChestChestSideAndLidDL);
+    Gfx* sideCmd = ResourceMgr_LoadGfxByHandle(&sTreasureChestChestSideAndLidDLHandle);
     int sideIndex = 0;
     while (sideCmd->words.w0 >> 24 != G_ENDDL) {
         gSkullTreasureChestChestSideAndLidDL[sideIndex] = *sideCmd;
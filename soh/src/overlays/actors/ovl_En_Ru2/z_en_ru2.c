@@ -9,6 +9,8 @@
 #include "overlays/actors/ovl_Door_Warp1/z_door_warp1.h"
 #include "vt.h"
 
+static ResourceHandle sAdultRutoHeadDLHandle = RESOURCE_HANDLE(gAdultRutoHeadDL);
+
 #define FLAGS ACTOR_FLAG_UPDATE_WHILE_CULLED
 
 void EnRu2_Init(Actor* thisx, PlayState* play);
@@ -829,7 +831,7 @@ void EnRu2_Draw(Actor* thisx, PlayState* play) {
     // texel samplers are not intended to be used for the same texture with different settings, so this misuse confuses
     // our texture cache, and we load the wrong settings for the earrings texture. This patch is a hack that replaces
     // TEXEL1 with TEXEL0, which is most likely the original intention, and all is well.
-    Gfx* gfx = ResourceMgr_LoadGfxByName(gAdultRutoHeadDL);
+    Gfx* gfx = ResourceMgr_LoadGfxByHandle(&sAdultRutoHeadDLHandle);
     Gfx patch = gsDPSetCombineLERP(TEXEL0, 0, PRIMITIVE, 0, TEXEL0, 0, ENVIRONMENT, 0, 0, 0, 0, COMBINED, TEXEL0, 0,
                                   PRIM_LOD_FRAC, COMBINED);
     gfx[0xA2] = patch;
@@ -45,6 +45,8 @@ const ActorInit Magic_Fire_InitVars = {
 
 #include "overlays/ovl_Magic_Fire/ovl_Magic_Fire.h"
 
+static ResourceHandle sSphereVtxHandle = RESOURCE_HANDLE(sSphereVtx);
+
 static ColliderCylinderInit sCylinderInit = {
     {
         COLTYPE_NONE,
@@ -258,7 +260,7 @@ void MagicFire_Draw(Actor* thisx, PlayState* play) {
         CLOSE_DISPS(play->state.gfxCtx);
 
         alpha = (s32)(this->alphaMultiplier * 255);
-        Vtx* vertices = ResourceMgr_LoadVtxByName(sSphereVtx);
+        Vtx* vertices = ResourceMgr_LoadVtxByHandle(&sSphereVtxHandle);
         for (i = 0; i < 36; i++) {
             vertices[sVertexIndices[i]].n.a = alpha;
         }
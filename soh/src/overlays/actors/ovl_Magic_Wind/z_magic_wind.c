@@ -34,6 +34,8 @@ const ActorInit Magic_Wind_InitVars = {
 
 #include "overlays/ovl_Magic_Wind/ovl_Magic_Wind.h"
 
+static ResourceHandle sCylinderVtxHandle = RESOURCE_HANDLE(sCylinderVtx);
+
 static u8 sAlphaUpdVals[] = {
     0x00, 0x03, 0x04, 0x07, 0x09, 0x0A, 0x0D, 0x0F, 0x11, 0x12, 0x15, 0x16, 0x19, 0x1B, 0x1C, 0x1F, 0x21, 0x23,
 };
@@ -78,7 +80,7 @@ void MagicWind_Destroy(Actor* thisx, PlayState* play) {
 void MagicWind_UpdateAlpha(f32 alpha) {
     s32 i;
 
-    Vtx* vtx = ResourceMgr_LoadVtxByName(sCylinderVtx);
+    Vtx* vtx = ResourceMgr_LoadVtxByHandle(&sCylinderVtxHandle);
 
     for (i = 0; i < ARRAY_COUNT(sAlphaUpdVals); i++) {
         vtx[sAlphaUpdVals[i]].n.a = alpha * 255.0f;
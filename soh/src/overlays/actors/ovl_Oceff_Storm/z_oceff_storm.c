@@ -123,6 +123,8 @@ void OceffStorm_Update(Actor* thisx, PlayState* play) {
 
 #include "overlays/ovl_Oceff_Storm/ovl_Oceff_Storm.h"
 
+static ResourceHandle sCylinderVtxHandle = RESOURCE_HANDLE(sCylinderVtx);
+
 void OceffStorm_Draw2(Actor* thisx, PlayState* play) {
     u32 scroll = play->state.frames & 0xFFF;
     OceffStorm* this = (OceffStorm*)thisx;
@@ -148,7 +150,7 @@ void OceffStorm_Draw2(Actor* thisx, PlayState* play) {
 void OceffStorm_Draw(Actor* thisx, PlayState* play) {
     u32 scroll = play->state.frames & 0xFFF;
     OceffStorm* this = (OceffStorm*)thisx;
-    Vtx* vtxPtr = ResourceMgr_LoadVtxByName(sCylinderVtx);
+    Vtx* vtxPtr = ResourceMgr_LoadVtxByHandle(&sCylinderVtxHandle);
 
     OPEN_DISPS(play->state.gfxCtx);
 
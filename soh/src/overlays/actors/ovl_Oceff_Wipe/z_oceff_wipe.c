@@ -59,6 +59,8 @@ void OceffWipe_Update(Actor* thisx, PlayState* play) {
 
 #include "overlays/ovl_Oceff_Wipe/ovl_Oceff_Wipe.h"
 
+static ResourceHandle sFrustumVtxHandle = RESOURCE_HANDLE(sFrustumVtx);
+
 static u8 sAlphaIndices[] = {
     0x01, 0x10, 0x22, 0x01, 0x20, 0x12, 0x01, 0x20, 0x12, 0x01,
     0x10, 0x22, 0x01, 0x20, 0x12, 0x01, 0x12, 0x21, 0x01, 0x02,
@@ -98,7 +100,7 @@ void OceffWipe_Draw(Actor* thisx, PlayState* play) {
     }
 
     for (i = 0; i < 20; i++) {
-        vtxPtr = ResourceMgr_LoadVtxByName(sFrustumVtx);
+        vtxPtr = ResourceMgr_LoadVtxByHandle(&sFrustumVtxHandle);
         vtxPtr[i * 2 + 0].v.cn[3] = alphaTable[(sAlphaIndices[i] & 0xF0) >> 4];
         vtxPtr[i * 2 + 1].v.cn[3] = alphaTable[sAlphaIndices[i] & 0xF];
     }
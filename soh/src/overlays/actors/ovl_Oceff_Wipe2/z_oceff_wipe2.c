@@ -59,6 +59,8 @@ void OceffWipe2_Update(Actor* thisx, PlayState* play) {
 
 #include "overlays/ovl_Oceff_Wipe2/ovl_Oceff_Wipe2.h"
 
+static ResourceHandle sFrustumVtxHandle = RESOURCE_HANDLE(sFrustumVtx);
+
 void OceffWipe2_Draw(Actor* thisx, PlayState* play) {
     u32 scroll = play->state.frames & 0xFF;
     OceffWipe2* this = (OceffWipe2*)thisx;
@@ -79,7 +81,7 @@ void OceffWipe2_Draw(Actor* thisx, PlayState* play) {
         z = fastOcarinaPlayback ? 1200.0f : 1330.0f;
     }
 
-    vtxPtr = ResourceMgr_LoadVtxByName(sFrustumVtx);
+    vtxPtr = ResourceMgr_LoadVtxByHandle(&sFrustumVtxHandle);
     if (this->timer >= 80) {
         alpha = 12 * (100 - this->timer);
     } else {
@@ -29,6 +29,8 @@ const ActorInit Oceff_Wipe3_InitVars = {
 
 #include "overlays/ovl_Oceff_Wipe3/ovl_Oceff_Wipe3.h"
 
+static ResourceHandle sFrustumVtxHandle = RESOURCE_HANDLE(sFrustumVtx);
+
 void OceffWipe3_Init(Actor* thisx, PlayState* play) {
     OceffWipe3* this = (OceffWipe3*)thisx;
 
@@ -80,7 +82,7 @@ void OceffWipe3_Draw(Actor* thisx, PlayState* play) {
         z = fastOcarinaPlayback ? 1200.0f : 1330.0f;
     }
 
-    vtxPtr = ResourceMgr_LoadVtxByName(sFrustumVtx);
+    vtxPtr = ResourceMgr_LoadVtxByHandle(&sFrustumVtxHandle);
     if (this->counter >= 80) {
         alpha = 12 * (100 - this->counter);
     } else {
@@ -55,6 +55,8 @@ void OceffWipe4_Update(Actor* thisx, PlayState* play) {
 
 #include "overlays/ovl_Oceff_Wipe4/ovl_Oceff_Wipe4.h"
 
+static ResourceHandle sFrustumVtxHandle = RESOURCE_HANDLE(sFrustumVtx);
+
 void OceffWipe4_Draw(Actor* thisx, PlayState* play) {
     u32 scroll = play->state.frames & 0xFFF;
     OceffWipe4* this = (OceffWipe4*)thisx;
@@ -75,7 +77,7 @@ void OceffWipe4_Draw(Actor* thisx, PlayState* play) {
         z = fastOcarinaPlayback ? 1200.0f : 1330.0f;
     }
 
-    vtxPtr = ResourceMgr_LoadVtxByName(sFrustumVtx);
+    vtxPtr = ResourceMgr_LoadVtxByHandle(&sFrustumVtxHandle);
     if (this->timer >= 30) {
         alpha = 12 * (50 - this->timer);
     } else {
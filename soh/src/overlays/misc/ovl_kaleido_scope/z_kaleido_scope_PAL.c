@@ -2635,29 +2635,12 @@ static s16 D_8082B1F8[] = {
     48, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
 };
 
-void KaleidoScope_InitVertices(PlayState* play, GraphicsContext* gfxCtx) {
+static void KaleidoScope_InitMapPageVertices(PlayState* play, GraphicsContext* gfxCtx) {
     PauseContext* pauseCtx = &play->pauseCtx;
-    s16 phi_t1;
     s16 phi_t2;
-    s16 phi_t2_2;
     s16 phi_t3;
-    s16 phi_t4;
     s16 phi_t5;
 
-    pauseCtx->offsetY = 0;
-
-    if ((pauseCtx->state == 4) || (pauseCtx->state >= 0x12) ||
-        ((pauseCtx->state == 7) && ((pauseCtx->unk_1EC == 2) || (pauseCtx->unk_1EC == 5))) ||
-        ((pauseCtx->state >= 8) && (pauseCtx->state <= 0xD))) {
-        pauseCtx->offsetY = 80;
-    }
-
-    pauseCtx->itemPageVtx = Graph_Alloc(gfxCtx, 60 * sizeof(Vtx));
-    func_80823A0C(play, pauseCtx->itemPageVtx, 0, 0);
-
-    pauseCtx->equipPageVtx = Graph_Alloc(gfxCtx, 60 * sizeof(Vtx));
-    func_80823A0C(play, pauseCtx->equipPageVtx, 1, 0);
-
     if (!sInDungeonScene) {
         pauseCtx->mapPageVtx = Graph_Alloc(gfxCtx, 248 * sizeof(Vtx));
         phi_t3 = func_80823A0C(play, pauseCtx->mapPageVtx, 4, 32);
@@ -2708,6 +2691,24 @@ void KaleidoScope_InitVertices(PlayState* play, GraphicsContext* gfxCtx) {
         pauseCtx->mapPageVtx = Graph_Alloc(gfxCtx, 128 * sizeof(Vtx));
         func_80823A0C(play, pauseCtx->mapPageVtx, 2, 17);
     }
+}
+
+static void KaleidoScope_GenerateVertices(PlayState* play, GraphicsContext* gfxCtx) {
+    PauseContext* pauseCtx = &play->pauseCtx;
+    s16 phi_t1;
+    s16 phi_t2;
+    s16 phi_t2_2;
+    s16 phi_t3;
+    s16 phi_t4;
+    s16 phi_t5;
+
+    pauseCtx->itemPageVtx = Graph_Alloc(gfxCtx, 60 * sizeof(Vtx));
+    func_80823A0C(play, pauseCtx->itemPageVtx, 0, 0);
+
+    pauseCtx->equipPageVtx = Graph_Alloc(gfxCtx, 60 * sizeof(Vtx));
+    func_80823A0C(play, pauseCtx->equipPageVtx, 1, 0);
+
+    KaleidoScope_InitMapPageVertices(play, gfxCtx);
 
     pauseCtx->questPageVtx = Graph_Alloc(gfxCtx, 60 * sizeof(Vtx));
     func_80823A0C(play, pauseCtx->questPageVtx, 3, 0);
@@ -3082,6 +3083,112 @@ void KaleidoScope_InitVertices(PlayState* play, GraphicsContext* gfxCtx) {
     func_80823A0C(play, pauseCtx->saveVtx, 5, 5);
 }
 
+// Inputs that KaleidoScope_GenerateVertices reads, so its output can be retained while they don't change
+typedef struct {
+    s16 offsetY;
+    u16 alpha;
+    s16 inDungeonScene;
+    s32 worldMapArea;
+    u16 equipment;
+    u8 cButtonSlots[ARRAY_COUNT(gSaveContext.equips.cButtonSlots)];
+    u8 dpadEquips;
+} KaleidoVtxCacheKey;
+
+typedef struct {
+    Vtx itemPageVtx[60];
+    Vtx equipPageVtx[60];
+    Vtx mapPageVtx[248];
+    Vtx questPageVtx[60];
+    Vtx cursorVtx[20];
+    Vtx itemVtx[(24 + 7 + 14) * 4];
+    Vtx equipVtx[112];
+    Vtx questVtx[188];
+    Vtx saveVtx[80];
+} KaleidoVtxCache;
+
+static KaleidoVtxCacheKey sVtxCacheKey;
+static KaleidoVtxCache sVtxCache;
+static u8 sVtxCacheValid = false;
+
+#define KALEIDO_VTX_CACHE_COPY(field, toCache)                                      \
+    do {                                                                            \
+        if (toCache) {                                                              \
+            memcpy(sVtxCache.field, pauseCtx->field, sizeof(sVtxCache.field));      \
+        } else {                                                                    \
+            pauseCtx->field = Graph_Alloc(gfxCtx, sizeof(sVtxCache.field));         \
+            memcpy(pauseCtx->field, sVtxCache.field, sizeof(sVtxCache.field));      \
+        }                                                                           \
+    } while (0)
+
+/**
+ * The page, item, equipment, quest and cursor vertices only depend on a handful of inputs, so they are
+ * generated once and copied into each frame's buffers until one of those inputs changes. The draw code
+ * still edits the per-frame copies (cursor position, selected item size, map highlights) as before.
+ */
+void KaleidoScope_InitVertices(PlayState* play, GraphicsContext* gfxCtx) {
+    PauseContext* pauseCtx = &play->pauseCtx;
+    KaleidoVtxCacheKey key;
+    u8 canRetain;
+    u8 toCache;
+
+    pauseCtx->offsetY = 0;
+
+    if ((pauseCtx->state == 4) || (pauseCtx->state >= 0x12) ||
+        ((pauseCtx->state == 7) && ((pauseCtx->unk_1EC == 2) || (pauseCtx->unk_1EC == 5))) ||
+        ((pauseCtx->state >= 8) && (pauseCtx->state <= 0xD))) {
+        pauseCtx->offsetY = 80;
+    }
+
+    memset(&key, 0, sizeof(key));
+    key.offsetY = pauseCtx->offsetY;
+    key.alpha = pauseCtx->alpha;
+    key.inDungeonScene = sInDungeonScene;
+    key.worldMapArea = gSaveContext.worldMapArea;
+    key.equipment = gSaveContext.equips.equipment;
+    memcpy(key.cButtonSlots, gSaveContext.equips.cButtonSlots, sizeof(key.cButtonSlots));
+    key.dpadEquips = CVarGetInteger("gDpadEquips", 0);
+
+    // The save and game over prompts position their quads from debug registers, so always rebuild those
+    canRetain = !((pauseCtx->state >= 8) && (pauseCtx->state <= 0x11));
+
+    if (!canRetain || !sVtxCacheValid || memcmp(&key, &sVtxCacheKey, sizeof(key)) != 0) {
+        KaleidoScope_GenerateVertices(play, gfxCtx);
+
+        sVtxCacheValid = canRetain;
+        if (!canRetain) {
+            return;
+        }
+        sVtxCacheKey = key;
+        toCache = true;
+    } else {
+        toCache = false;
+    }
+
+    KALEIDO_VTX_CACHE_COPY(itemPageVtx, toCache);
+    KALEIDO_VTX_CACHE_COPY(equipPageVtx, toCache);
+    KALEIDO_VTX_CACHE_COPY(questPageVtx, toCache);
+    KALEIDO_VTX_CACHE_COPY(cursorVtx, toCache);
+    KALEIDO_VTX_CACHE_COPY(itemVtx, toCache);
+    KALEIDO_VTX_CACHE_COPY(equipVtx, toCache);
+    KALEIDO_VTX_CACHE_COPY(questVtx, toCache);
+    KALEIDO_VTX_CACHE_COPY(saveVtx, toCache);
+
+    if (toCache) {
+        memcpy(sVtxCache.mapPageVtx, pauseCtx->mapPageVtx, (sInDungeonScene ? 128 : 248) * sizeof(Vtx));
+        return;
+    }
+
+    pauseCtx->infoPanelVtx = Graph_Alloc(gfxCtx, 28 * sizeof(Vtx));
+
+    if (!sInDungeonScene && (pauseCtx->tradeQuestLocation != 0xFF)) {
+        // The trade quest marker bobs every frame, so the world map page is still rebuilt while it's shown
+        KaleidoScope_InitMapPageVertices(play, gfxCtx);
+    } else {
+        pauseCtx->mapPageVtx = Graph_Alloc(gfxCtx, (sInDungeonScene ? 128 : 248) * sizeof(Vtx));
+        memcpy(pauseCtx->mapPageVtx, sVtxCache.mapPageVtx, (sInDungeonScene ? 128 : 248) * sizeof(Vtx));
+    }
+}
+
 void KaleidoScope_DrawGameOver(PlayState* play) {
     GraphicsContext* gfxCtx = play->state.gfxCtx;
 